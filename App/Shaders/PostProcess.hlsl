@@ -0,0 +1,173 @@
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float4 color : COLOR0;
+    float2 uv : TEXCOORD0;
+};
+
+cbuffer PSConstants2D : register(b0)
+{
+    float4 g_colorAdd;
+    float4 g_sdfParam;
+    float4 g_sdfOutlineColor;
+    float4 g_sdfShadowColor;
+    float4 g_internal;
+};
+
+#define MAX_SHOCKWAVES 8
+
+struct Shockwave
+{
+    float2 center;
+    float radius;
+    float thickness;
+    float force;
+    float3 padding;
+};
+
+cbuffer PostProcessParams : register(b1)
+{
+    uint flags;
+    float time;
+    float2 invTextureSize;
+
+    float waveAmplitude;
+    float waveFrequency;
+    float waveSpeed;
+    float chromaticIntensity;
+
+    float chromaticRadialStrength;
+    uint shockwaveCount;
+    float2 padding;
+
+    float timeOfDay;
+    float moonlightIntensity;
+    float phaseBlend;
+    float starsBonus;
+
+    Shockwave shockwaves[MAX_SHOCKWAVES];
+};
+
+static const uint FLAG_SHOCKWAVE = 1;
+static const uint FLAG_WAVE = 2;
+static const uint FLAG_CHROMATIC = 4;
+static const uint FLAG_DAYNIGHT = 8;
+
+Texture2D g_texture0 : register(t0);
+SamplerState g_sampler0 : register(s0);
+
+float3 ApplyDayNight(float3 dayColor, float2 screenUV)
+{
+    float3 sunsetColor = lerp(dayColor, dayColor * float3(1.2, 0.8, 0.6), 0.6);
+    float3 nightColor = dayColor * float3(0.3, 0.3, 0.5) + float3(0.0, 0.0, moonlightIntensity * 0.2);
+    float3 dawnColor = lerp(nightColor, dayColor * float3(0.9, 0.8, 1.0), 0.5);
+
+    float3 resultColor;
+
+    if (timeOfDay < 0.5)
+    {
+        resultColor = dayColor;
+    }
+    else if (timeOfDay < 0.65)
+    {
+        float t = (timeOfDay - 0.5) / 0.15;
+        resultColor = lerp(dayColor, sunsetColor, t);
+    }
+    else if (timeOfDay < 0.85)
+    {
+        float t = (timeOfDay - 0.65) / 0.2;
+        resultColor = lerp(sunsetColor, nightColor, min(t * 2.0, 1.0));
+
+        float moonPhase = sin(timeOfDay * 6.28318) * 0.5 + 0.5;
+        resultColor += float3(0.05, 0.05, 0.1) * moonlightIntensity * moonPhase;
+
+        resultColor += float3(0.1, 0.1, 0.15) * starsBonus;
+    }
+    else
+    {
+        float t = (timeOfDay - 0.85) / 0.15;
+        resultColor = lerp(nightColor, dawnColor, t);
+    }
+
+    resultColor = lerp(resultColor, dayColor, phaseBlend * 0.1);
+
+    float2 vignetteCoord = screenUV * 2.0 - 1.0;
+    float vignette = 1.0 - dot(vignetteCoord, vignetteCoord) * 0.3;
+
+    if (timeOfDay >= 0.65 && timeOfDay < 0.85)
+    {
+        vignette = 1.0 - dot(vignetteCoord, vignetteCoord) * 0.5;
+    }
+
+    return resultColor * vignette;
+}
+
+float4 PS(PSInput input) : SV_TARGET
+{
+    float2 uv = input.uv;
+    float shockwaveIntensity = 0.0;
+
+    if (flags & FLAG_SHOCKWAVE)
+    {
+        float2 offset = float2(0.0, 0.0);
+
+        uint count = min(shockwaveCount, (uint)MAX_SHOCKWAVES);
+
+        for (uint i = 0; i < count; ++i)
+        {
+            float2 dir = input.uv - shockwaves[i].center;
+            float dist = length(dir);
+            float diff = abs(dist - shockwaves[i].radius);
+
+            if (diff < shockwaves[i].thickness && 0.0 < dist)
+            {
+                float intensity = 1.0 - (diff / shockwaves[i].thickness);
+                intensity = intensity * intensity;
+                offset += (dir / dist) * intensity * shockwaves[i].force;
+                shockwaveIntensity = max(shockwaveIntensity, intensity);
+            }
+        }
+
+        uv += offset;
+    }
+
+    if (flags & FLAG_WAVE)
+    {
+        float wave = sin(uv.y * waveFrequency + time * waveSpeed) * waveAmplitude;
+        uv.x += wave * invTextureSize.x;
+
+        float wave2 = cos(uv.x * waveFrequency * 0.7 + time * waveSpeed * 1.3) * waveAmplitude * 0.5;
+        uv.y += wave2 * invTextureSize.y;
+    }
+
+    float4 texColor;
+
+    if (flags & FLAG_CHROMATIC)
+    {
+        float2 dir = uv - float2(0.5, 0.5);
+        float aberration = chromaticIntensity + length(dir) * chromaticRadialStrength;
+
+        texColor.r = g_texture0.Sample(g_sampler0, uv + dir * aberration * 0.01).r;
+        texColor.g = g_texture0.Sample(g_sampler0, uv + dir * aberration * 0.005).g;
+        texColor.b = g_texture0.Sample(g_sampler0, uv - dir * aberration * 0.01).b;
+        texColor.a = g_texture0.Sample(g_sampler0, uv).a;
+    }
+    else
+    {
+        texColor = g_texture0.Sample(g_sampler0, uv);
+    }
+
+    float4 color = texColor * input.color + g_colorAdd;
+
+    if (flags & FLAG_SHOCKWAVE)
+    {
+        color.rgb = lerp(color.rgb, float3(1.0, 0.8, 0.3), shockwaveIntensity * 0.3);
+    }
+
+    if (flags & FLAG_DAYNIGHT)
+    {
+        color.rgb = ApplyDayNight(color.rgb, input.uv);
+    }
+
+    return color;
+}
@@ -0,0 +1,106 @@
+﻿#include "AllocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	thread_local bool t_isCounting = false;
+	thread_local size_t t_allocationCount = 0;
+}
+
+void AllocationCounter::Begin()
+{
+	t_allocationCount = 0;
+	t_isCounting = true;
+}
+
+size_t AllocationCounter::End()
+{
+	t_isCounting = false;
+	return t_allocationCount;
+}
+
+#ifdef ALIENS_DAYS_HEADLESS
+
+namespace
+{
+	// _aligned_malloc の領域は _aligned_free でしか解放できないので、確保と解放を対にしておく
+	void* AlignedMalloc(size_t size, size_t alignment) noexcept
+	{
+#ifdef _WIN32
+		return _aligned_malloc(size, alignment);
+#else
+		// aligned_alloc はサイズがアラインメントの倍数でなければならない
+		return std::aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment);
+#endif
+	}
+
+	void AlignedFree(void* p) noexcept
+	{
+#ifdef _WIN32
+		_aligned_free(p);
+#else
+		std::free(p);
+#endif
+	}
+
+	void* TryAllocate(size_t size) noexcept
+	{
+		if (t_isCounting)
+		{
+			++t_allocationCount;
+		}
+		return std::malloc((size == 0) ? 1 : size);
+	}
+
+	void* TryAllocateAligned(size_t size, std::align_val_t alignment) noexcept
+	{
+		if (t_isCounting)
+		{
+			++t_allocationCount;
+		}
+		return AlignedMalloc(((size == 0) ? 1 : size), static_cast<size_t>(alignment));
+	}
+
+	void* Allocate(size_t size)
+	{
+		if (void* p = TryAllocate(size))
+		{
+			return p;
+		}
+		throw std::bad_alloc{};
+	}
+
+	void* AllocateAligned(size_t size, std::align_val_t alignment)
+	{
+		if (void* p = TryAllocateAligned(size, alignment))
+		{
+			return p;
+		}
+		throw std::bad_alloc{};
+	}
+}
+
+void* operator new(size_t size) { return Allocate(size); }
+void* operator new[](size_t size) { return Allocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TryAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TryAllocate(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TryAllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TryAllocateAligned(size, alignment); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(p); }
+
+#endif
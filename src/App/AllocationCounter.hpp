@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// グローバルな operator new の呼び出し回数を数える（ヘッドレス実行の --alloc-check 用）
+// operator new の置き換えは Headless 構成（ALIENS_DAYS_HEADLESS）でだけ行う（他の構成では常に0）
+// 数えるのは Begin() を呼んだスレッドの確保だけ（エンジンの他のスレッドは含めない）
+class AllocationCounter
+{
+public:
+	// このスレッドで数え始める（それまでの回数は捨てる）
+	static void Begin();
+
+	// 数えるのをやめ、Begin() からの回数を返す
+	static size_t End();
+};
@@ -1,5 +1,9 @@
 ﻿#include "Application.hpp"
 #include "../Sound/SoundManager.hpp"
+#include "../Core/TraceCapture.hpp"
+#include "../Core/TextureCache.hpp"
+#include "../Core/FontRegistry.hpp"
+#include "../Enemies/EnemyBase.hpp"
 
 Application::Application()
 	: m_sceneManager(nullptr)
@@ -18,6 +22,12 @@ bool Application::init()
 	Window::SetTitle(U"Siv3D Game");
 	Window::Resize(1920, 1080);
 
+	// 起動時の読み込みも記録したい場合は --trace を付けて起動する（F4 で停止・書き出し）
+	if (System::GetCommandLineArgs().includes(U"--trace"))
+	{
+		TraceCapture::Start();
+	}
+
 	// SoundManagerの初期化
 	SoundManager::GetInstance().init();
 
@@ -53,10 +63,17 @@ void Application::shutdown()
 {
 	m_isRunning = false;
 
+	// 記録中のトレースは終了時に書き出す
+	TraceCapture::Stop(TraceCapture::MakeDefaultPath());
+
 	// SoundManagerのクリーンアップ
 	SoundManager::GetInstance().cleanup();
 
 	m_sceneManager.reset();
+
+	EnemyBase::ReleaseSpriteSets();
+	TextureCache::Clear();
+	FontRegistry::Clear();
 }
 
 bool Application::isRunning() const
@@ -71,6 +88,19 @@ void Application::update()
 		return;
 	}
 
+	// F4 でトレースの記録を開始・停止（停止時に JSON を書き出す）
+	if (KeyF4.down())
+	{
+		if (TraceCapture::IsCapturing())
+		{
+			TraceCapture::Stop(TraceCapture::MakeDefaultPath());
+		}
+		else
+		{
+			TraceCapture::Start();
+		}
+	}
+
 	m_sceneManager->update();
 }
 
@@ -0,0 +1,474 @@
+﻿#include "HeadlessRunner.hpp"
+#include "AllocationCounter.hpp"
+#include "../Scenes/GameScene.hpp"
+#include "../Scenes/CharacterSelectScene.hpp"
+#include "../Core/SimulationClock.hpp"
+#include "../Core/MemoryArena.hpp"
+#include "../Core/SystemTimings.hpp"
+#include "../Effects/ParticlePool.hpp"
+
+HeadlessRunner::Options HeadlessRunner::ParseCommandLine(const Array<String>& args)
+{
+	Options options;
+
+	for (const auto& arg : args)
+	{
+		if (arg.starts_with(U"--stage="))
+		{
+			const int stage = ParseOr<int>(arg.substr(8), 1);
+			options.stage = static_cast<StageNumber>(Clamp(stage, 1, 6));
+		}
+		else if (arg.starts_with(U"--ticks="))
+		{
+			options.ticks = ParseOr<uint64>(arg.substr(8), options.ticks);
+		}
+		else if (arg.starts_with(U"--seed="))
+		{
+			options.seed = ParseOr<uint64>(arg.substr(7), options.seed);
+		}
+		else if (arg.starts_with(U"--input="))
+		{
+			options.inputScriptPath = arg.substr(8);
+		}
+		else if (arg.starts_with(U"--replay="))
+		{
+			options.replayPath = arg.substr(9);
+		}
+		else if (arg.starts_with(U"--particle-bench="))
+		{
+			options.particleBenchCount = ParseOr<size_t>(arg.substr(17), 0);
+		}
+		else if (arg.starts_with(U"--raycast-bench="))
+		{
+			options.raycastBenchCount = ParseOr<size_t>(arg.substr(16), 0);
+		}
+		else if (arg.starts_with(U"--stage-query-bench="))
+		{
+			options.stageQueryBenchCount = ParseOr<size_t>(arg.substr(20), 0);
+		}
+		else if (arg.starts_with(U"--alloc-check="))
+		{
+			options.allocCheckTicks = ParseOr<uint64>(arg.substr(14), 0);
+		}
+	}
+
+	return options;
+}
+
+bool HeadlessRunner::run(const Options& requestedOptions)
+{
+	Options options = requestedOptions;
+
+	if (options.particleBenchCount > 0)
+	{
+		RunParticleBenchmark(options.particleBenchCount);
+		return true;
+	}
+
+	if (options.raycastBenchCount > 0)
+	{
+		RunRaycastBenchmark(options.stage, options.raycastBenchCount);
+		return true;
+	}
+
+	if (options.stageQueryBenchCount > 0)
+	{
+		RunStageQueryBenchmark(options.stageQueryBenchCount);
+		return true;
+	}
+
+	m_inputSpans.clear();
+	m_isReplaying = false;
+	if (!options.replayPath.isEmpty())
+	{
+		if (!m_replay.load(options.replayPath))
+		{
+			Console << U"Failed to load replay: " << options.replayPath;
+			return false;
+		}
+
+		// リプレイの記録時と同じ条件で開始する
+		const auto& header = m_replay.getHeader();
+		options.stage = header.stage;
+		options.seed = header.seed;
+		options.ticks = header.tickCount;
+		CharacterSelectScene::setSelectedPlayerColor(header.color);
+		m_isReplaying = true;
+	}
+	else if (!options.inputScriptPath.isEmpty())
+	{
+		if (!loadInputScript(options.inputScriptPath))
+		{
+			return false;
+		}
+	}
+	m_previousHeld = HeldButtons{};
+
+	if (options.allocCheckTicks > 0)
+	{
+		return runAllocationCheck(options);
+	}
+
+	auto scene = std::make_unique<GameScene>(options.stage);
+	scene->initSimulation(options.stage, options.seed);
+
+	// ゲームオーバー・クリアで止まった場合はステージを読み込み直して続ける
+	SystemTimings timings;
+	size_t restartCount = 0;
+	const auto accumulateTimings = [&]() {
+		for (size_t i = 0; i < SystemTimings::SYSTEM_COUNT; ++i)
+		{
+			const auto system = static_cast<SimulationSystem>(i);
+			timings.add(system, scene->getSystemTimings().get(system));
+		}
+	};
+
+	const Stopwatch stopwatch{ StartImmediately::Yes };
+
+	for (uint64 tick = 0; tick < options.ticks; ++tick)
+	{
+		// フレームの一時配列はティックごとに捨てる（SceneManagers::update() と同じ）
+		FrameScratch::Reset();
+		scene->stepSimulation(getInput(tick));
+
+		if (scene->getNextScene() && !m_isReplaying)
+		{
+			accumulateTimings();
+			scene->cleanup();
+			scene = std::make_unique<GameScene>(options.stage);
+			scene->initSimulation(options.stage, options.seed);
+			++restartCount;
+		}
+	}
+
+	const double elapsedSec = stopwatch.sF();
+	accumulateTimings();
+
+	// 結果の出力
+	const double ticksPerSec = (elapsedSec > 0.0) ? (options.ticks / elapsedSec) : 0.0;
+	Console << U"=== Headless simulation ===";
+	Console << U"Stage: {} | Ticks: {} ({:.1f}s of gameplay) | Restarts: {}"_fmt(
+		static_cast<int>(options.stage), options.ticks, options.ticks * SimulationClock::FIXED_DELTA_TIME, restartCount);
+	Console << U"Elapsed: {:.3f}s | {:.0f} ticks/sec ({:.1f}x realtime)"_fmt(
+		elapsedSec, ticksPerSec, ticksPerSec * SimulationClock::FIXED_DELTA_TIME);
+
+	const double totalMicrosec = timings.getTotal();
+	for (size_t i = 0; i < SystemTimings::SYSTEM_COUNT; ++i)
+	{
+		const auto system = static_cast<SimulationSystem>(i);
+		const double microsec = timings.get(system);
+		Console << U"  {:<16} {:>10.1f} ms | {:>8.2f} us/tick | {:>5.1f}%"_fmt(
+			SystemTimings::GetName(system),
+			microsec / 1000.0,
+			(options.ticks > 0) ? (microsec / options.ticks) : 0.0,
+			(totalMicrosec > 0.0) ? (microsec / totalMicrosec * 100.0) : 0.0);
+	}
+
+	bool succeeded = true;
+	if (const Player* player = scene->getPlayer())
+	{
+		const Vec2 position = player->getPosition();
+		Console << U"Final player position: ({:.1f}, {:.1f}) | Enemies: {}"_fmt(position.x, position.y, scene->getEnemyCount());
+
+		// リプレイは記録時の最終位置とビット単位で一致するはず
+		if (m_isReplaying)
+		{
+			const Vec2 expected = m_replay.getHeader().finalPlayerPosition;
+			if (position == expected)
+			{
+				Console << U"Replay check: OK";
+			}
+			else
+			{
+				Console << U"Replay check: MISMATCH (expected ({:.3f}, {:.3f}))"_fmt(expected.x, expected.y);
+				succeeded = false;
+			}
+		}
+	}
+
+	return succeeded;
+}
+
+void HeadlessRunner::RunParticleBenchmark(size_t particleCount)
+{
+	constexpr int UPDATE_COUNT = 600;  // 60Hz で10秒分
+
+	// ファイアボール撃破エフェクトと同じ設定。寿命は計測中に尽きないようにする
+	ParticlePool pool{ particleCount, ParticlePool::Motion{ Vec2(0.0, 400.0), Vec2(0.98, 0.98), 0.9999, 0.5 } };
+	for (size_t i = 0; i < particleCount; ++i)
+	{
+		ParticlePool::Particle particle;
+		particle.position = RandomVec2(RectF{ 0, 0, 1280, 720 });
+		particle.velocity = RandomVec2(400.0);
+		particle.life = UPDATE_COUNT * SimulationClock::FIXED_DELTA_TIME * 2.0;
+		particle.size = Random(3.0, 8.0);
+		particle.rotationSpeed = Random(-15.0, 15.0);
+		pool.spawn(particle);
+	}
+
+	const Stopwatch stopwatch{ StartImmediately::Yes };
+
+	for (int i = 0; i < UPDATE_COUNT; ++i)
+	{
+		pool.update(SimulationClock::FIXED_DELTA_TIME);
+	}
+
+	const double elapsedMicrosec = stopwatch.usF();
+	const double particleUpdates = static_cast<double>(particleCount) * UPDATE_COUNT;
+
+	Console << U"=== Particle benchmark ===";
+	Console << U"Particles: {} | Updates: {} | Alive: {}"_fmt(particleCount, UPDATE_COUNT, pool.size());
+	Console << U"Elapsed: {:.3f} ms | {:.1f} us/update | {:.2f} ns/particle"_fmt(
+		elapsedMicrosec / 1000.0,
+		elapsedMicrosec / UPDATE_COUNT,
+		(particleUpdates > 0.0) ? (elapsedMicrosec * 1000.0 / particleUpdates) : 0.0);
+}
+
+void HeadlessRunner::RunRaycastBenchmark(StageNumber stageNumber, size_t rayCount)
+{
+	constexpr double MAX_DISTANCE = 1024.0;  // 16ブロック分
+
+	const Stage stage{ stageNumber };
+	const RectF bounds = stage.getTileGridBounds();
+
+	// 乱数の生成は計測に含めないよう先に作っておく
+	Array<Vec2> origins(rayCount);
+	Array<Vec2> directions(rayCount);
+	for (size_t i = 0; i < rayCount; ++i)
+	{
+		origins[i] = RandomVec2(bounds);
+		directions[i] = RandomVec2(1.0);
+	}
+
+	const Stopwatch rayStopwatch{ StartImmediately::Yes };
+	size_t rayHits = 0;
+	for (size_t i = 0; i < rayCount; ++i)
+	{
+		if (stage.raycast(origins[i], directions[i], MAX_DISTANCE))
+		{
+			++rayHits;
+		}
+	}
+	const double rayElapsedSec = rayStopwatch.sF();
+
+	// 敵と同じくらいの大きさの矩形
+	const Stopwatch boxStopwatch{ StartImmediately::Yes };
+	size_t boxHits = 0;
+	for (size_t i = 0; i < rayCount; ++i)
+	{
+		if (stage.boxcast(RectF{ Arg::center = origins[i], 48, 48 }, directions[i], MAX_DISTANCE))
+		{
+			++boxHits;
+		}
+	}
+	const double boxElapsedSec = boxStopwatch.sF();
+
+	Console << U"=== Raycast benchmark ===";
+	Console << U"Stage: {} | Casts: {} | Max distance: {}"_fmt(static_cast<int>(stageNumber), rayCount, MAX_DISTANCE);
+	Console << U"Raycast: {:.3f} ms | {:.2f} M rays/sec | Hits: {}"_fmt(
+		rayElapsedSec * 1000.0,
+		(rayElapsedSec > 0.0) ? (rayCount / rayElapsedSec / 1'000'000.0) : 0.0,
+		rayHits);
+	Console << U"Boxcast: {:.3f} ms | {:.2f} M casts/sec | Hits: {}"_fmt(
+		boxElapsedSec * 1000.0,
+		(boxElapsedSec > 0.0) ? (rayCount / boxElapsedSec / 1'000'000.0) : 0.0,
+		boxHits);
+}
+
+void HeadlessRunner::RunStageQueryBenchmark(size_t queryCount)
+{
+	// タイルグリッドならステージ幅によらず1回あたりの時間はほぼ一定になるはず
+	constexpr std::array<int, 4> STAGE_WIDTHS = { 80, 320, 1280, 5120 };
+
+	Console << U"=== Stage query benchmark ===";
+	Console << U"Queries per kind: {}"_fmt(queryCount);
+	Console << U"  {:>6} {:>12} {:>12} {:>12} {:>12} {:>12}  (ns/query)"_fmt(
+		U"Width", U"isBlockSolid", U"groundPos", U"collision", U"canFitAt", U"oneBlockGap");
+
+	for (const int width : STAGE_WIDTHS)
+	{
+		Stage stage;
+		stage.generateSyntheticLayout(width);
+		const RectF bounds = stage.getTileGridBounds();
+		const int blockSize = stage.getBlockSize();
+
+		// 乱数の生成は計測に含めないよう先に作っておく
+		Array<Vec2> positions(queryCount);
+		Array<Point> cells(queryCount);
+		for (size_t i = 0; i < queryCount; ++i)
+		{
+			positions[i] = RandomVec2(bounds);
+			cells[i] = Point{ Random(0, stage.getGridWidth() - 1), Random(0, stage.getGridHeight() - 1) };
+		}
+
+		// 結果を集計して、クエリが最適化で消されないようにする
+		size_t hits = 0;
+		double groundSum = 0.0;
+
+		const auto measure = [queryCount](auto&& query) {
+			const Stopwatch stopwatch{ StartImmediately::Yes };
+			for (size_t i = 0; i < queryCount; ++i)
+			{
+				query(i);
+			}
+			return stopwatch.usF() * 1000.0 / static_cast<double>(queryCount);
+		};
+
+		const double solidNs = measure([&](size_t i) { hits += stage.isBlockSolid(cells[i].x, cells[i].y); });
+		const double groundNs = measure([&](size_t i) { groundSum += stage.getGroundPosition(positions[i].x).y; });
+		const double collisionNs = measure([&](size_t i) { hits += stage.checkCollision(RectF{ Arg::center = positions[i], blockSize, blockSize }); });
+		const double fitNs = measure([&](size_t i) { hits += stage.canPlayerFitAt(positions[i]); });
+		const double gapNs = measure([&](size_t i) { hits += stage.hasOneBlockGap(cells[i].x, cells[i].y); });
+
+		Console << U"  {:>6} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f}  (hits: {}, ground: {:.0f})"_fmt(
+			width, solidNs, groundNs, collisionNs, fitNs, gapNs, hits, groundSum);
+	}
+}
+
+bool HeadlessRunner::runAllocationCheck(const Options& options)
+{
+	// 初回の描画で作るレイヤー・チャンク、使い回す配列の容量、グリフのキャッシュは暖機中に済ませる
+	// 敵の画像とプールはステージの読み込み時に出現リストの分だけ用意されるので、出現のたびには確保しない
+	constexpr uint64 WARMUP_TICKS = 120;
+
+	auto scene = std::make_unique<GameScene>(options.stage);
+	scene->initRendering();
+	scene->initSimulation(options.stage, options.seed);
+
+	const auto runTick = [&](uint64 tick) {
+		FrameScratch::Reset();
+		scene->stepSimulation(getInput(tick));
+		scene->draw();
+	};
+
+	for (uint64 tick = 0; tick < WARMUP_TICKS; ++tick)
+	{
+		runTick(tick);
+	}
+
+	const size_t scratchOverflowBefore = FrameScratch::GetOverflowCount();
+	uint64 measuredTicks = 0;
+
+	AllocationCounter::Begin();
+	while (measuredTicks < options.allocCheckTicks && !scene->getNextScene())
+	{
+		runTick(WARMUP_TICKS + measuredTicks);
+		++measuredTicks;
+	}
+	const size_t allocationCount = AllocationCounter::End();
+
+	Console << U"=== Allocation check ===";
+	Console << U"Stage: {} | Warmup: {} ticks | Measured: {} ticks (update + draw)"_fmt(
+		static_cast<int>(options.stage), WARMUP_TICKS, measuredTicks);
+	Console << U"operator new: {} calls ({:.2f} / tick) | Frame scratch overflows: {}"_fmt(
+		allocationCount,
+		(measuredTicks > 0) ? (static_cast<double>(allocationCount) / measuredTicks) : 0.0,
+		FrameScratch::GetOverflowCount() - scratchOverflowBefore);
+
+	// シーンが途中で終わると残りのティックを確認できていないので失敗として扱う
+	const bool endedEarly = (measuredTicks < options.allocCheckTicks);
+	if (endedEarly)
+	{
+		Console << U"Scene ended after {} of {} ticks"_fmt(measuredTicks, options.allocCheckTicks);
+	}
+
+	const bool passed = ((allocationCount == 0) && !endedEarly);
+	Console << (passed ? U"Allocation check: PASS" : U"Allocation check: FAIL");
+	return passed;
+}
+
+bool HeadlessRunner::loadInputScript(const FilePath& path)
+{
+	TextReader reader{ path };
+	if (!reader)
+	{
+		Console << U"Failed to open input script: " << path;
+		return false;
+	}
+
+	m_inputSpans.clear();
+
+	String line;
+	while (reader.readLine(line))
+	{
+		// コメントを除去
+		if (const size_t commentPos = line.indexOf(U'#'); commentPos != String::npos)
+		{
+			line.resize(commentPos);
+		}
+
+		const Array<String> tokens = line.split(U' ').removed_if([](const String& token) { return token.isEmpty(); });
+		if (tokens.size() < 2) continue;
+
+		InputSpan span;
+		span.beginTick = ParseOr<uint64>(tokens[0], 0);
+		span.endTick = ParseOr<uint64>(tokens[1], 0);
+
+		for (size_t i = 2; i < tokens.size(); ++i)
+		{
+			const String& button = tokens[i];
+			if (button == U"left") span.buttons.left = true;
+			else if (button == U"right") span.buttons.right = true;
+			else if (button == U"up") span.buttons.up = true;
+			else if (button == U"down") span.buttons.down = true;
+			else if (button == U"jump") span.buttons.jump = true;
+			else if (button == U"fire") span.buttons.fire = true;
+			else Console << U"Unknown button in input script: " << button;
+		}
+
+		m_inputSpans << span;
+	}
+
+	return true;
+}
+
+HeadlessRunner::HeldButtons HeadlessRunner::getHeldButtons(uint64 tick) const
+{
+	HeldButtons held;
+
+	if (m_inputSpans.isEmpty())
+	{
+		// 既定の入力：右に走り続け、一定間隔でジャンプと攻撃を繰り返す
+		held.right = true;
+		held.jump = (tick % 90) < 20;
+		held.fire = (tick % 240) < 5;
+		return held;
+	}
+
+	for (const auto& span : m_inputSpans)
+	{
+		if (tick < span.beginTick || span.endTick < tick) continue;
+
+		held.left |= span.buttons.left;
+		held.right |= span.buttons.right;
+		held.up |= span.buttons.up;
+		held.down |= span.buttons.down;
+		held.jump |= span.buttons.jump;
+		held.fire |= span.buttons.fire;
+	}
+	return held;
+}
+
+PlayerInput HeadlessRunner::getInput(uint64 tick)
+{
+	if (m_isReplaying)
+	{
+		return m_replay.next();
+	}
+
+	const HeldButtons held = getHeldButtons(tick);
+
+	PlayerInput input;
+	input.left = held.left;
+	input.right = held.right;
+	input.up = held.up;
+	input.down = held.down;
+	input.jumpPressed = held.jump;
+
+	// 押した瞬間の入力は前のティックとの差分から作る
+	input.jumpDown = held.jump && !m_previousHeld.jump;
+	input.fireDown = held.fire && !m_previousHeld.fire;
+
+	m_previousHeld = held;
+	return input;
+}
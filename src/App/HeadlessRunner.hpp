@@ -0,0 +1,72 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include "../Stages/Stage.hpp"
+#include "../Player/PlayerInput.hpp"
+#include "../Player/InputReplay.hpp"
+
+// 描画なしで GameScene のゲームプレイを指定ティック数だけ回し、処理速度を報告する
+// Headless|x64 構成（ALIENS_DAYS_HEADLESS を定義）でビルドすると Main() からこちらが実行される
+//
+// 引数: --stage=<1-6> --ticks=<N> --seed=<N> --input=<入力スクリプト> --replay=<リプレイファイル>
+// 入力スクリプトは1行につき「開始ティック 終了ティック ボタン...」（ボタン: left right up down jump fire, # 以降はコメント）
+// リプレイを指定した場合はステージ・キャラクター・シード・ティック数をリプレイに合わせ、最終位置を照合する
+// --particle-bench=<N> を指定した場合はゲームプレイの代わりに N 個のパーティクル更新を計測する
+// --raycast-bench=<N> を指定した場合は --stage のステージで N 本のレイキャスト・ボックスキャストを計測する
+// --stage-query-bench=<N> を指定した場合は幅の異なる合成ステージで衝突判定クエリを N 回ずつ計測する
+// --alloc-check=<N> を指定した場合は暖機後の N ティック（更新と描画）で operator new が呼ばれないことを確認する
+//   入力は通常の実行と同じ（既定の入力・入力スクリプト・リプレイ）。1回でも確保があるか、N ティック経つ前にシーンが終われば FAIL
+// リプレイの不一致・確認の FAIL・読み込みの失敗では run() が false を返し、Main() は終了コード 1 で終わる
+class HeadlessRunner
+{
+public:
+	struct Options
+	{
+		StageNumber stage = StageNumber::Stage1;
+		uint64 ticks = 36000;  // 60Hz で10分
+		uint64 seed = 0;
+		FilePath inputScriptPath;
+		FilePath replayPath;
+		size_t particleBenchCount = 0;
+		size_t raycastBenchCount = 0;
+		size_t stageQueryBenchCount = 0;
+		uint64 allocCheckTicks = 0;
+	};
+
+	static Options ParseCommandLine(const Array<String>& args);
+
+	bool run(const Options& requestedOptions);
+
+private:
+	// 1ティック分の押し続けているボタン
+	struct HeldButtons
+	{
+		bool left = false;
+		bool right = false;
+		bool up = false;
+		bool down = false;
+		bool jump = false;
+		bool fire = false;
+	};
+
+	// 指定ティック範囲で押し続けるボタン
+	struct InputSpan
+	{
+		uint64 beginTick = 0;
+		uint64 endTick = 0;  // この値を含む
+		HeldButtons buttons;
+	};
+
+	Array<InputSpan> m_inputSpans;  // 空の場合は既定の入力（右に走りながらジャンプと攻撃）
+	HeldButtons m_previousHeld;
+	InputReplay m_replay;
+	bool m_isReplaying = false;
+
+	static void RunParticleBenchmark(size_t particleCount);
+	static void RunRaycastBenchmark(StageNumber stageNumber, size_t rayCount);
+	static void RunStageQueryBenchmark(size_t queryCount);
+	bool runAllocationCheck(const Options& options);
+
+	bool loadInputScript(const FilePath& path);
+	HeldButtons getHeldButtons(uint64 tick) const;
+	PlayerInput getInput(uint64 tick);
+};
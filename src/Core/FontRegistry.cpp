@@ -0,0 +1,81 @@
+﻿#include "FontRegistry.hpp"
+
+HashTable<uint64, Font> FontRegistry::s_fonts;
+
+Font FontRegistry::Get(int32 size, Typeface typeface)
+{
+	const uint64 key = (static_cast<uint64>(static_cast<uint32>(size)) << 8) | static_cast<uint64>(typeface);
+
+	auto it = s_fonts.find(key);
+	if (it == s_fonts.end())
+	{
+		it = s_fonts.emplace(key, Font{ size, typeface }).first;
+	}
+	return it->second;
+}
+
+void FontRegistry::Clear()
+{
+	s_fonts.clear();
+}
+
+GlyphText& GlyphText::append(StringView text)
+{
+	for (const char32 ch : text)
+	{
+		if (m_length == CAPACITY) break;
+		m_buffer[m_length++] = ch;
+	}
+	return *this;
+}
+
+GlyphText& GlyphText::append(int64 value, int32 minDigits)
+{
+	// 下の桁から一時バッファに書き、逆順に追加する
+	std::array<char32, 20> digits;
+	size_t digitCount = 0;
+	uint64 magnitude = (value < 0) ? (0 - static_cast<uint64>(value)) : static_cast<uint64>(value);
+
+	do
+	{
+		digits[digitCount++] = static_cast<char32>(U'0' + (magnitude % 10));
+		magnitude /= 10;
+	} while (magnitude != 0 && digitCount < digits.size());
+
+	while (static_cast<int32>(digitCount) < minDigits && digitCount < digits.size())
+	{
+		digits[digitCount++] = U'0';
+	}
+
+	if (value < 0 && m_length < CAPACITY)
+	{
+		m_buffer[m_length++] = U'-';
+	}
+
+	while (digitCount > 0 && m_length < CAPACITY)
+	{
+		m_buffer[m_length++] = digits[--digitCount];
+	}
+	return *this;
+}
+
+SizeF GlyphText::size() const
+{
+	double width = 0.0;
+	for (const char32 ch : view())
+	{
+		width += m_font.getGlyph(ch).xAdvance;
+	}
+	return SizeF{ width, static_cast<double>(m_font.height()) };
+}
+
+void GlyphText::draw(const Vec2& pos, const ColorF& color) const
+{
+	Vec2 penPos = pos;
+	for (const char32 ch : view())
+	{
+		const Glyph glyph = m_font.getGlyph(ch);
+		glyph.texture.draw(penPos + glyph.getOffset(), color);
+		penPos.x += glyph.xAdvance;
+	}
+}
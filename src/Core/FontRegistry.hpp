@@ -0,0 +1,86 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// サイズと書体をキーにしたフォントの共有
+// 描画のたびに Font を作るとグリフキャッシュが毎回作り直されるため、フォントは必ずここから取得する
+class FontRegistry
+{
+public:
+	// Font はハンドルなので値で返しても同じフォントを共有する
+	static Font Get(int32 size, Typeface typeface = Typeface::Regular);
+
+	// エンジン終了前にすべて解放する
+	static void Clear();
+
+private:
+	static HashTable<uint64, Font> s_fonts;
+};
+
+// 組み済みの DrawableText（ステージ名など、ほとんど変わらない文字列用）
+// set() は内容が変わったときだけ組み直すので、描画側は get() で描くだけでよい
+class CachedText
+{
+public:
+	CachedText() = default;
+
+	explicit CachedText(const Font& font)
+		: m_font(font)
+	{
+	}
+
+	void set(StringView text)
+	{
+		if (m_isBuilt && text == m_string) return;
+
+		m_string = text;
+		m_drawableText = m_font(m_string);
+		m_isBuilt = true;
+	}
+
+	const DrawableText& get() const { return m_drawableText; }
+
+private:
+	Font m_font;
+	String m_string;
+	DrawableText m_drawableText;
+	bool m_isBuilt = false;
+};
+
+// 値が頻繁に変わる短い文字列（経過時間・残り時間など）用
+// 固定長のバッファに書き込み、グリフを1文字ずつ並べて描くので、内容が変わっても確保しない
+class GlyphText
+{
+public:
+	static constexpr size_t CAPACITY = 64;
+
+	GlyphText() = default;
+
+	explicit GlyphText(const Font& font)
+		: m_font(font)
+	{
+	}
+
+	GlyphText& clear()
+	{
+		m_length = 0;
+		return *this;
+	}
+
+	// 入りきらない分は切り捨てる
+	GlyphText& append(StringView text);
+
+	// 10進数で追加する（minDigits に満たない桁は0で埋める）
+	GlyphText& append(int64 value, int32 minDigits = 1);
+
+	StringView view() const { return StringView{ m_buffer.data(), m_length }; }
+
+	SizeF size() const;
+
+	// pos は左上
+	void draw(const Vec2& pos, const ColorF& color) const;
+
+private:
+	Font m_font;
+	std::array<char32, CAPACITY> m_buffer{};
+	size_t m_length = 0;
+};
@@ -0,0 +1,215 @@
+﻿#include "FrameProfiler.hpp"
+
+namespace
+{
+	constexpr double OVERLAY_WIDTH = 480.0;
+	constexpr double ROW_HEIGHT = 16.0;
+	constexpr double GRAPH_HEIGHT = 120.0;
+	constexpr double GRAPH_MAX_MICROSECONDS = 33333.0;  // グラフの上端（30fps 相当）
+	constexpr double FRAME_BUDGET_MICROSECONDS = 16667.0;
+}
+
+StringView FrameProfiler::GetName(DrawPass pass)
+{
+	switch (pass)
+	{
+	case DrawPass::Stage:          return U"Stage";
+	case DrawPass::Coins:          return U"Coins";
+	case DrawPass::Stars:          return U"Stars";
+	case DrawPass::Blocks:         return U"Blocks";
+	case DrawPass::Enemies:        return U"Enemies";
+	case DrawPass::Effects:        return U"Effects";
+	case DrawPass::Player:         return U"Player";
+	case DrawPass::HUD:            return U"HUD";
+	case DrawPass::PostProcess:    return U"PostProcess";
+	default:                       return U"Unknown";
+	}
+}
+
+void FrameProfiler::beginUpdate(const SystemTimings& timings)
+{
+	for (size_t i = 0; i < UPDATE_SECTION_COUNT; ++i)
+	{
+		m_updateStartTimings[i] = timings.get(static_cast<SimulationSystem>(i));
+	}
+	m_updateStartNanosec = Time::GetNanosec();
+}
+
+void FrameProfiler::endUpdate(const SystemTimings& timings)
+{
+	m_currentUpdateTotal = (Time::GetNanosec() - m_updateStartNanosec) / 1000.0;
+
+	for (size_t i = 0; i < UPDATE_SECTION_COUNT; ++i)
+	{
+		m_current[i] = timings.get(static_cast<SimulationSystem>(i)) - m_updateStartTimings[i];
+	}
+}
+
+void FrameProfiler::beginDraw()
+{
+	m_drawStartNanosec = Time::GetNanosec();
+}
+
+void FrameProfiler::endDraw()
+{
+	FrameRecord& record = m_history[m_historyHead];
+	record.sections = m_current;
+	record.updateTotal = m_currentUpdateTotal;
+	record.drawTotal = (Time::GetNanosec() - m_drawStartNanosec) / 1000.0;
+
+	commitFrame();
+}
+
+void FrameProfiler::commitFrame()
+{
+	m_historyHead = (m_historyHead + 1) % HISTORY_SIZE;
+	m_historyCount = Min(m_historyCount + 1, HISTORY_SIZE);
+
+	m_current.fill(0.0);
+	m_currentUpdateTotal = 0.0;
+
+	// 統計は表示中だけ求める
+	if (m_overlayVisible)
+	{
+		updateStats();
+	}
+}
+
+template <class Getter>
+FrameProfiler::SectionStats FrameProfiler::computeStats(Getter getValue)
+{
+	SectionStats stats;
+	if (m_historyCount == 0) return stats;
+
+	m_sortScratch.clear();
+	double sum = 0.0;
+	for (size_t i = 0; i < m_historyCount; ++i)
+	{
+		const double value = getValue(m_history[i]);
+		m_sortScratch.push_back(value);
+		sum += value;
+	}
+	stats.average = sum / m_historyCount;
+
+	// 上位1%の境界値（全体の並べ替えは不要）
+	const size_t p99Index = Min(static_cast<size_t>(m_historyCount * 0.99), m_historyCount - 1);
+	std::nth_element(m_sortScratch.begin(), m_sortScratch.begin() + p99Index, m_sortScratch.end());
+	stats.p99 = m_sortScratch[p99Index];
+
+	return stats;
+}
+
+void FrameProfiler::updateStats()
+{
+	for (size_t section = 0; section < SECTION_COUNT; ++section)
+	{
+		m_sectionStats[section] = computeStats([section](const FrameRecord& record) { return record.sections[section]; });
+	}
+	m_updateStats = computeStats([](const FrameRecord& record) { return record.updateTotal; });
+	m_drawStats = computeStats([](const FrameRecord& record) { return record.drawTotal; });
+}
+
+StringView FrameProfiler::GetSectionName(size_t section)
+{
+	if (section < UPDATE_SECTION_COUNT)
+	{
+		return SystemTimings::GetName(static_cast<SimulationSystem>(section));
+	}
+	return GetName(static_cast<DrawPass>(section - UPDATE_SECTION_COUNT));
+}
+
+ColorF FrameProfiler::GetSectionColor(size_t section)
+{
+	// 更新は寒色系、描画は暖色系
+	if (section < UPDATE_SECTION_COUNT)
+	{
+		return HSV{ 170.0 + section * 9.0, 0.6, 0.95 };
+	}
+	return HSV{ (section - UPDATE_SECTION_COUNT) * 6.0, 0.65, 0.95 };
+}
+
+void FrameProfiler::drawOverlay(const Font& font) const
+{
+	if (!m_overlayVisible) return;
+
+	const size_t rowCount = SECTION_COUNT + 5;  // 見出し・更新合計・描画合計・フレーム合計・ポストエフェクト
+	const RectF panel{ Scene::Width() - OVERLAY_WIDTH - 10, 10, OVERLAY_WIDTH, rowCount * ROW_HEIGHT + GRAPH_HEIGHT + 20 };
+	panel.draw(ColorF(0.0, 0.0, 0.0, 0.75));
+
+	const double nameX = panel.x + 22;
+	const double averageX = panel.x + 250;
+	const double p99X = panel.x + 360;
+	double y = panel.y + 4;
+
+	font(U"Section").draw(nameX, y, Palette::White);
+	font(U"avg ms").draw(averageX, y, Palette::White);
+	font(U"p99 ms").draw(p99X, y, Palette::White);
+	y += ROW_HEIGHT;
+
+	const auto drawRow = [&](StringView name, const SectionStats& stats, const ColorF& color) {
+		RectF{ panel.x + 6, y + 3, 10, 10 }.draw(color);
+		font(name).draw(nameX, y, Palette::White);
+		font(U"{:.3f}"_fmt(stats.average / 1000.0)).draw(averageX, y, Palette::White);
+		font(U"{:.3f}"_fmt(stats.p99 / 1000.0)).draw(p99X, y, Palette::White);
+		y += ROW_HEIGHT;
+	};
+
+	for (size_t section = 0; section < SECTION_COUNT; ++section)
+	{
+		const StringView category = (section < UPDATE_SECTION_COUNT) ? U"update" : U"draw";
+		drawRow(U"{}/{}"_fmt(category, GetSectionName(section)), m_sectionStats[section], GetSectionColor(section));
+	}
+	drawRow(U"update total", m_updateStats, ColorF(0.4, 0.6, 0.7));
+	drawRow(U"draw total", m_drawStats, ColorF(0.7, 0.5, 0.4));
+
+	SectionStats frameStats;
+	frameStats.average = m_updateStats.average + m_drawStats.average;
+	frameStats.p99 = m_updateStats.p99 + m_drawStats.p99;
+	drawRow(U"frame (avg sum / p99 sum)", frameStats, ColorF(0.8, 0.8, 0.8));
+
+	font(U"post process: {} pass(es), {} shockwave(s)"_fmt(m_postProcessPassCount, m_shockwaveCount)).draw(nameX, y, Palette::White);
+	y += ROW_HEIGHT;
+
+	// 積み上げグラフ（左が古いフレーム）。各フレームは更新の内訳→更新の計測外→描画の内訳→描画の計測外の順に積む
+	const RectF graph{ panel.x + 6, y + 8, OVERLAY_WIDTH - 12, GRAPH_HEIGHT };
+	graph.draw(ColorF(0.1, 0.1, 0.1, 0.8));
+
+	const double barWidth = graph.w / HISTORY_SIZE;
+	const double scale = graph.h / GRAPH_MAX_MICROSECONDS;
+	const size_t oldest = (m_historyHead + HISTORY_SIZE - m_historyCount) % HISTORY_SIZE;
+
+	for (size_t i = 0; i < m_historyCount; ++i)
+	{
+		const FrameRecord& record = m_history[(oldest + i) % HISTORY_SIZE];
+		const double x = graph.x + (HISTORY_SIZE - m_historyCount + i) * barWidth;
+		double bottom = graph.bottomY();
+
+		const auto stack = [&](double microseconds, const ColorF& color) {
+			const double height = Min(microseconds * scale, bottom - graph.y);
+			if (height <= 0.0) return;
+			RectF{ x, bottom - height, barWidth, height }.draw(color);
+			bottom -= height;
+		};
+
+		double updateSum = 0.0;
+		for (size_t section = 0; section < UPDATE_SECTION_COUNT; ++section)
+		{
+			stack(record.sections[section], GetSectionColor(section));
+			updateSum += record.sections[section];
+		}
+		stack(record.updateTotal - updateSum, ColorF(0.4, 0.6, 0.7));
+
+		double drawSum = 0.0;
+		for (size_t section = UPDATE_SECTION_COUNT; section < SECTION_COUNT; ++section)
+		{
+			stack(record.sections[section], GetSectionColor(section));
+			drawSum += record.sections[section];
+		}
+		stack(record.drawTotal - drawSum, ColorF(0.7, 0.5, 0.4));
+	}
+
+	// 60fps の予算ライン
+	const double budgetY = graph.bottomY() - FRAME_BUDGET_MICROSECONDS * scale;
+	Line{ graph.x, budgetY, graph.rightX(), budgetY }.draw(1.0, ColorF(1.0, 0.3, 0.3, 0.8));
+	font(U"16.7ms").draw(graph.x + 2, budgetY - ROW_HEIGHT, ColorF(1.0, 0.5, 0.5));
+}
@@ -0,0 +1,129 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include <array>
+#include "SystemTimings.hpp"
+
+// 計測対象の描画パス
+enum class DrawPass : uint8
+{
+	Stage,
+	Coins,
+	Stars,
+	Blocks,
+	Enemies,
+	Effects,
+	Player,
+	HUD,
+	PostProcess,
+
+	Count
+};
+
+// 直近のフレームの更新・描画の内訳を記録し、オーバーレイに表示する
+// 描画パスは CPU 側の処理時間（描画コマンドの発行まで）を計測する
+class FrameProfiler
+{
+public:
+	static constexpr size_t UPDATE_SECTION_COUNT = SystemTimings::SYSTEM_COUNT;
+	static constexpr size_t DRAW_SECTION_COUNT = static_cast<size_t>(DrawPass::Count);
+	static constexpr size_t SECTION_COUNT = UPDATE_SECTION_COUNT + DRAW_SECTION_COUNT;
+	static constexpr size_t HISTORY_SIZE = 240;  // 60fps で4秒分
+
+	static StringView GetName(DrawPass pass);
+
+	// update() の前後で呼ぶ（シミュレーションの内訳は SystemTimings の累計の差分から求める）
+	void beginUpdate(const SystemTimings& timings);
+	void endUpdate(const SystemTimings& timings);
+
+	// draw() の前後で呼ぶ（endDraw() でフレームを履歴に確定する）
+	void beginDraw();
+	void endDraw();
+
+	void addDraw(DrawPass pass, double microseconds)
+	{
+		m_current[UPDATE_SECTION_COUNT + static_cast<size_t>(pass)] += microseconds;
+	}
+
+	// 直前のフレームのポストエフェクトの内訳（全画面パス数・衝撃波の数）
+	void setPostProcessStats(size_t passCount, size_t shockwaveCount)
+	{
+		m_postProcessPassCount = passCount;
+		m_shockwaveCount = shockwaveCount;
+	}
+
+	void toggleOverlay() { m_overlayVisible = !m_overlayVisible; }
+	bool isOverlayVisible() const { return m_overlayVisible; }
+
+	void drawOverlay(const Font& font) const;
+
+private:
+	// 1フレーム分の記録（マイクロ秒）
+	struct FrameRecord
+	{
+		std::array<double, SECTION_COUNT> sections{};
+		double updateTotal = 0.0;
+		double drawTotal = 0.0;
+	};
+
+	// 履歴から求めた統計（オーバーレイ表示中のみ更新）
+	struct SectionStats
+	{
+		double average = 0.0;
+		double p99 = 0.0;
+	};
+
+	std::array<FrameRecord, HISTORY_SIZE> m_history{};
+	size_t m_historyHead = 0;   // 次に書き込む位置
+	size_t m_historyCount = 0;
+
+	std::array<double, SECTION_COUNT> m_current{};
+	std::array<double, UPDATE_SECTION_COUNT> m_updateStartTimings{};
+	uint64 m_updateStartNanosec = 0;
+	uint64 m_drawStartNanosec = 0;
+	double m_currentUpdateTotal = 0.0;
+
+	std::array<SectionStats, SECTION_COUNT> m_sectionStats{};
+	SectionStats m_updateStats;
+	SectionStats m_drawStats;
+	Array<double> m_sortScratch;  // p99 計算用（使い回して再確保を避ける）
+
+	size_t m_postProcessPassCount = 0;
+	size_t m_shockwaveCount = 0;
+
+	bool m_overlayVisible = false;
+
+	void commitFrame();
+	void updateStats();
+	template <class Getter>
+	SectionStats computeStats(Getter getValue);
+
+	static StringView GetSectionName(size_t section);
+	static ColorF GetSectionColor(size_t section);
+};
+
+// スコープ内の描画処理の時間を FrameProfiler に加算する
+class ScopedDrawTimer
+{
+public:
+	ScopedDrawTimer(FrameProfiler& profiler, DrawPass pass)
+		: m_profiler(profiler)
+		, m_pass(pass)
+		, m_startNanosec(Time::GetNanosec())
+		, m_trace(FrameProfiler::GetName(pass))
+	{
+	}
+
+	~ScopedDrawTimer()
+	{
+		m_profiler.addDraw(m_pass, (Time::GetNanosec() - m_startNanosec) / 1000.0);
+	}
+
+	ScopedDrawTimer(const ScopedDrawTimer&) = delete;
+	ScopedDrawTimer& operator=(const ScopedDrawTimer&) = delete;
+
+private:
+	FrameProfiler& m_profiler;
+	DrawPass m_pass;
+	uint64 m_startNanosec;
+	ScopedTrace m_trace;
+};
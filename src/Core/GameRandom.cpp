@@ -0,0 +1,23 @@
+﻿#include "GameRandom.hpp"
+
+namespace
+{
+	DefaultRNG s_engine{ 0 };
+	uint64 s_seed = 0;
+}
+
+void GameRandom::Reseed(uint64 seed)
+{
+	s_seed = seed;
+	s_engine.seed(seed);
+}
+
+uint64 GameRandom::GetSeed()
+{
+	return s_seed;
+}
+
+double GameRandom::Range(double min, double max)
+{
+	return Random(min, max, s_engine);
+}
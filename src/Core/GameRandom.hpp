@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// ゲームプレイ用の乱数
+// セッション開始時にシードを設定し、リプレイでは同じシードから同じ乱数列を再現する
+// （描画だけに使う乱数はグローバルの Random() のままでよい）
+class GameRandom
+{
+public:
+	static void Reseed(uint64 seed);
+	static uint64 GetSeed();
+
+	// [min, max] の一様乱数
+	static double Range(double min, double max);
+};
@@ -0,0 +1,51 @@
+﻿#include "MemoryArena.hpp"
+
+void* CountingResource::do_allocate(size_t bytes, size_t alignment)
+{
+	++m_allocationCount;
+	m_allocatedBytes += bytes;
+	return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void CountingResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+	m_allocatedBytes -= bytes;
+	std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+SceneArena::SceneArena()
+	: m_resource(INITIAL_BLOCK_SIZE, &m_upstream)
+{
+}
+
+namespace
+{
+	struct FrameScratchState
+	{
+		std::unique_ptr<Byte[]> buffer{ new Byte[FrameScratch::BUFFER_SIZE] };
+		CountingResource upstream;
+		std::pmr::monotonic_buffer_resource resource{ buffer.get(), FrameScratch::BUFFER_SIZE, &upstream };
+	};
+
+	FrameScratchState& GetFrameScratch()
+	{
+		static FrameScratchState state;
+		return state;
+	}
+}
+
+std::pmr::memory_resource* FrameScratch::Resource()
+{
+	return &GetFrameScratch().resource;
+}
+
+void FrameScratch::Reset()
+{
+	// 固定バッファの先頭に戻す（あふれてヒープから確保した分はここで返す）
+	GetFrameScratch().resource.release();
+}
+
+size_t FrameScratch::GetOverflowCount()
+{
+	return GetFrameScratch().upstream.getAllocationCount();
+}
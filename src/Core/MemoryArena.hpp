@@ -0,0 +1,89 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// 上流（既定のヒープ）からの確保を数えるメモリリソース
+// アリーナがバッファを使い切ってヒープへ取りに行った回数の確認に使う
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+	size_t getAllocationCount() const { return m_allocationCount; }
+	size_t getAllocatedBytes() const { return m_allocatedBytes; }
+
+private:
+	size_t m_allocationCount = 0;
+	size_t m_allocatedBytes = 0;
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return (this == &other); }
+};
+
+// アリーナから確保したオブジェクトのデストラクタだけを呼ぶ（メモリはアリーナごと解放する）
+template <class Type>
+struct ArenaDeleter
+{
+	void operator()(Type* p) const { std::destroy_at(p); }
+};
+
+template <class Type>
+using ArenaPtr = std::unique_ptr<Type, ArenaDeleter<Type>>;
+
+// シーンと同じ寿命のモノトニックアリーナ
+// 個別には解放せず、シーンの破棄（cleanup() の直後）でまとめて解放する
+// シーンにつき1回だけ作るオブジェクト専用（作り直すものを置くと、古い領域はシーンの破棄まで残り続ける）
+// ArenaPtr はアリーナより先に破棄すること（SceneBase が持つので派生クラスのメンバーは必ず先に破棄される）
+class SceneArena
+{
+public:
+	SceneArena();
+
+	SceneArena(const SceneArena&) = delete;
+	SceneArena& operator=(const SceneArena&) = delete;
+
+	template <class Type, class... Args>
+	ArenaPtr<Type> create(Args&&... args)
+	{
+		void* p = m_resource.allocate(sizeof(Type), alignof(Type));
+		return ArenaPtr<Type>{ ::new (p) Type(std::forward<Args>(args)...) };
+	}
+
+	std::pmr::memory_resource* resource() { return &m_resource; }
+
+	// ヒープから確保したブロックの数とバイト数（最初のブロックを含む）
+	size_t getHeapBlockCount() const { return m_upstream.getAllocationCount(); }
+	size_t getHeapBytes() const { return m_upstream.getAllocatedBytes(); }
+
+private:
+	static constexpr size_t INITIAL_BLOCK_SIZE = 256 * 1024;
+
+	CountingResource m_upstream;
+	std::pmr::monotonic_buffer_resource m_resource;
+};
+
+// フレーム内だけ使う一時配列（次の FrameScratch::Reset() までに捨てること）
+template <class Type>
+using ScratchArray = std::vector<Type, std::pmr::polymorphic_allocator<Type>>;
+
+// フレームごとのバンプアロケーター
+// SceneManagers::update() の先頭で Reset() し、そのフレームの一時配列を固定バッファから切り出す
+class FrameScratch
+{
+public:
+	static std::pmr::memory_resource* Resource();
+
+	template <class Type>
+	static ScratchArray<Type> MakeArray()
+	{
+		return ScratchArray<Type>{ std::pmr::polymorphic_allocator<Type>{ Resource() } };
+	}
+
+	static void Reset();
+
+	// 固定バッファに収まらずヒープから確保した回数（起動からの累計）
+	static size_t GetOverflowCount();
+
+	static constexpr size_t BUFFER_SIZE = 512 * 1024;
+};
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
 #include "SceneType.hpp"
+#include "MemoryArena.hpp"
 
 // シーンの基底クラス
 class SceneBase
@@ -26,6 +27,9 @@ public:
 protected:
 	Optional<SceneType> m_requestedSceneChange;
 
+	// シーンと同じ寿命のアリーナ（派生クラスのメンバーより後に破棄されるので、ArenaPtr のメンバーを安全に持てる）
+	SceneArena m_arena;
+
 public:
 	Optional<SceneType> getRequestedSceneChange() const { return m_requestedSceneChange; }
 	void requestSceneChange(SceneType scene) { m_requestedSceneChange = scene; }
@@ -1,10 +1,31 @@
 ﻿//src/Core/SceneManager.cpp
 #include "SceneManagers.hpp"
 #include "../Core/SceneFactory.hpp"
+#include "TraceCapture.hpp"
+#include "MemoryArena.hpp"
+
+namespace
+{
+	// 宇宙っぽい色（青、紫、白、ピンク）
+	constexpr ColorF SPACE_COLORS[] = {
+		ColorF(0.8, 0.9, 1.0),   // 青白
+		ColorF(1.0, 0.8, 1.0),   // ピンク
+		ColorF(0.9, 0.8, 1.0),   // 紫
+		ColorF(1.0, 1.0, 1.0),   // 白
+		ColorF(0.7, 1.0, 1.0),   // シアン
+		ColorF(1.0, 1.0, 0.7)    // 淡い黄色
+	};
+
+	const ColorF& RandomSpaceColor()
+	{
+		return SPACE_COLORS[Random(std::size(SPACE_COLORS) - 1)];
+	}
+}
 
 SceneManagers::SceneManagers()
 	: m_currentScene(nullptr)
 	, m_currentSceneType(SceneType::Splash)
+	, m_spaceParticles(PARTICLE_COUNT, ParticlePool::Motion{})
 	, m_warpCenter(Scene::Center())
 {
 }
@@ -29,9 +50,14 @@ void SceneManagers::init(SceneType initialScene)
 
 void SceneManagers::update()
 {
+	// 前のフレーム（update と draw）の一時配列を捨てる
+	FrameScratch::Reset();
+
 	if (!m_currentScene)
 		return;
 
+	const ScopedTrace trace{ U"SceneManagers::update" };
+
 	if (m_fadeState == FadeState::None)
 	{
 		m_currentScene->update();
@@ -108,6 +134,8 @@ void SceneManagers::update()
 
 void SceneManagers::draw() const
 {
+	const ScopedTrace trace{ U"SceneManagers::draw" };
+
 	if (m_currentScene)
 	{
 		m_currentScene->draw();
@@ -130,6 +158,8 @@ void SceneManagers::draw() const
 
 void SceneManagers::changeScene(SceneType newScene)
 {
+	const ScopedTrace trace{ U"SceneManagers::changeScene" };
+
 	if (m_currentScene)
 	{
 		m_currentScene->cleanup();
@@ -179,13 +209,12 @@ void SceneManagers::createSpaceParticles()
 {
 	for (int i = 0; i < PARTICLE_COUNT; ++i)
 	{
-		SpaceParticle particle;
+		ParticlePool::Particle particle;
 
 		// 画面全体をカバーする初期位置（ランダム配置）
-		particle.position = Vec2(
-		Random(0.0, static_cast<double>(Scene::Width())),
-		Random(0.0, static_cast<double>(Scene::Height()))
-		);
+		const double x = Random(0.0, static_cast<double>(Scene::Width()));
+		const double y = Random(0.0, static_cast<double>(Scene::Height()));
+		particle.position = Vec2(x, y);
 
 		// 中央から外側に向かう方向
 		const Vec2 direction = (particle.position - m_warpCenter).normalized();
@@ -193,23 +222,10 @@ void SceneManagers::createSpaceParticles()
 		particle.velocity = direction * speed;
 
 		particle.life = Random(1.0, 1.8);
-		particle.maxLife = particle.life;
 		particle.size = Random(1.0, 5.0);
+		particle.color = RandomSpaceColor();
 
-		// 宇宙っぽい色（青、紫、白、ピンク）
-		const Array<ColorF> spaceColors = {
-			ColorF(0.8, 0.9, 1.0),   // 青白
-			ColorF(1.0, 0.8, 1.0),   // ピンク
-			ColorF(0.9, 0.8, 1.0),   // 紫
-			ColorF(1.0, 1.0, 1.0),   // 白
-			ColorF(0.7, 1.0, 1.0),   // シアン
-			ColorF(1.0, 1.0, 0.7)    // 淡い黄色
-		};
-
-		particle.color = spaceColors[Random(spaceColors.size() - 1)];
-		particle.brightness = Random(0.6, 1.0);
-
-		m_spaceParticles.push_back(particle);
+		m_spaceParticles.spawn(particle);
 	}
 }
 
@@ -217,38 +233,29 @@ void SceneManagers::updateSpaceParticles()
 {
 	const double deltaTime = Scene::DeltaTime();
 
-	for (auto& particle : m_spaceParticles)
-	{
-		// 位置更新
-		particle.position += particle.velocity * deltaTime;
+	// 位置・生存時間の更新と、死亡したパーティクルの削除
+	m_spaceParticles.update(deltaTime);
 
+	const ParticlePool::Columns particles = m_spaceParticles.columns();
+	const double acceleration = m_warpIntensity * 1200.0 * deltaTime;
+	const double growth = m_warpIntensity * 3.0;
+	for (size_t i = 0; i < m_spaceParticles.size(); ++i)
+	{
 		// ワープ効果による加速
-		const Vec2 centerDirection = (particle.position - m_warpCenter).normalized();
-		particle.velocity += centerDirection * (m_warpIntensity * 1200.0 * deltaTime);
-
-		// 生存時間更新
-		particle.life -= deltaTime;
-
-		// 明度更新（生存時間に応じて減衰）
-		particle.brightness = Math::Max(0.0, particle.life / particle.maxLife);
+		const Vec2 centerDirection = (Vec2(particles.positionX[i], particles.positionY[i]) - m_warpCenter).normalized();
+		particles.velocityX[i] += centerDirection.x * acceleration;
+		particles.velocityY[i] += centerDirection.y * acceleration;
 
 		// サイズ更新（ワープ効果で伸びる）
-		particle.size = particle.size + m_warpIntensity * 3.0;
+		particles.size[i] += growth;
 	}
 
-	// 死亡したパーティクルを削除
-	m_spaceParticles.erase(
-		std::remove_if(m_spaceParticles.begin(), m_spaceParticles.end(),
-			[](const SpaceParticle& p) { return p.life <= 0.0; }),
-		m_spaceParticles.end()
-	);
-
 	// パーティクルが少なくなったら画面全体に補充
 	if (m_spaceParticles.size() < PARTICLE_COUNT / 2 && m_warpIntensity > 0.2)
 	{
 		for (int i = 0; i < 20; ++i)
 		{
-			SpaceParticle newParticle;
+			ParticlePool::Particle newParticle;
 
 			// 画面端から新しいパーティクルを生成
 			const int edge = Random(3); // 0:上, 1:右, 2:下, 3:左
@@ -273,18 +280,10 @@ void SceneManagers::updateSpaceParticles()
 			newParticle.velocity = direction * speed;
 
 			newParticle.life = Random(0.8, 1.2);
-			newParticle.maxLife = newParticle.life;
 			newParticle.size = Random(1.0, 4.0);
+			newParticle.color = RandomSpaceColor();
 
-			const Array<ColorF> colors = {
-				ColorF(0.8, 0.9, 1.0), ColorF(1.0, 0.8, 1.0),
-				ColorF(0.9, 0.8, 1.0), ColorF(1.0, 1.0, 1.0),
-				ColorF(0.7, 1.0, 1.0), ColorF(1.0, 1.0, 0.7)
-			};
-			newParticle.color = colors[Random(colors.size() - 1)];
-			newParticle.brightness = Random(0.5, 1.0);
-
-			m_spaceParticles.push_back(newParticle);
+			m_spaceParticles.spawn(newParticle);
 		}
 	}
 }
@@ -297,36 +296,40 @@ void SceneManagers::drawSpaceTransition() const
 	drawFullScreenCover();
 
 	// 星のパーティクル描画
-	for (const auto& particle : m_spaceParticles)
+	for (size_t i = 0; i < m_spaceParticles.size(); ++i)
 	{
-		const double alpha = particle.brightness * particle.color.a;
+		// 明度は生存時間に応じて減衰
+		const ColorF& color = m_spaceParticles.getColor(i);
+		const double alpha = Math::Max(0.0, m_spaceParticles.getLifeRatio(i)) * color.a;
 		if (alpha > 0.02)
 		{
+			const Vec2 position = m_spaceParticles.getPosition(i);
+			const double size = m_spaceParticles.getSize(i);
 			const ColorF particleColor = ColorF(
-				particle.color.r,
-				particle.color.g,
-				particle.color.b,
+				color.r,
+				color.g,
+				color.b,
 				alpha
 			);
 
 			// パーティクル本体
-			Circle(particle.position, particle.size).draw(particleColor);
+			Circle(position, size).draw(particleColor);
 
 			// 光る効果
-			const double glowSize = particle.size * 2.5;
-			Circle(particle.position, glowSize).draw(
+			const double glowSize = size * 2.5;
+			Circle(position, glowSize).draw(
 				ColorF(particleColor.r, particleColor.g, particleColor.b, alpha * 0.4)
 			);
 
 			// ワープ効果による光線（より強力に）
 			if (m_warpIntensity > 0.3)
 			{
-				const Vec2 direction = (particle.position - m_warpCenter).normalized();
-				const Vec2 trailStart = particle.position - direction * particle.size * 15.0;
-				const Vec2 trailEnd = particle.position;
+				const Vec2 direction = (position - m_warpCenter).normalized();
+				const Vec2 trailStart = position - direction * size * 15.0;
+				const Vec2 trailEnd = position;
 
 				Line(trailStart, trailEnd).draw(
-					particle.size * 0.8,
+					size * 0.8,
 					ColorF(particleColor.r, particleColor.g, particleColor.b, alpha * 0.7)
 				);
 			}
@@ -3,25 +3,7 @@
 #include <memory>
 #include "SceneBase.hpp"
 #include "SceneFactory.hpp"
-
-// 宇宙エフェクト用の星パーティクル
-struct SpaceParticle
-{
-	Vec2 position;
-	Vec2 velocity;
-	double life;
-	double maxLife;
-	double size;
-	ColorF color;
-	double brightness;
-
-	SpaceParticle()
-		: position(Vec2::Zero()), velocity(Vec2::Zero())
-		, life(1.0), maxLife(1.0), size(2.0)
-		, color(Palette::White), brightness(1.0)
-	{
-	}
-};
+#include "../Effects/ParticlePool.hpp"
 
 class SceneManagers
 {
@@ -43,7 +25,7 @@ private:
 	SceneType m_currentSceneType;
 
 	// 宇宙エフェクト用メンバー
-	Array<SpaceParticle> m_spaceParticles;
+	ParticlePool m_spaceParticles;  // 宇宙エフェクト用の星パーティクル
 	double m_warpIntensity = 0.0;
 	Vec2 m_warpCenter;
 	static constexpr double TRANSITION_DURATION = 1.5; // 遷移時間
@@ -0,0 +1,69 @@
+﻿#include "SimulationClock.hpp"
+
+namespace
+{
+	double s_accumulator = 0.0;
+	double s_alpha = 0.0;
+	uint64 s_tickCount = 0;
+	bool s_inTick = false;
+
+	// 浮動小数点誤差で 1 ティック分に僅かに満たず、ティック数が揺らぐのを防ぐ
+	constexpr double TICK_EPSILON = 1e-9;
+}
+
+void SimulationClock::Reset()
+{
+	s_accumulator = 0.0;
+	s_alpha = 0.0;
+	s_tickCount = 0;
+	s_inTick = false;
+}
+
+int SimulationClock::Advance(double frameDeltaTime)
+{
+	s_accumulator += Max(frameDeltaTime, 0.0);
+
+	int steps = static_cast<int>((s_accumulator + TICK_EPSILON) / FIXED_DELTA_TIME);
+	s_accumulator = Max(s_accumulator - steps * FIXED_DELTA_TIME, 0.0);
+
+	// 長いヒッチの後に大量のティックを回さないよう、上限を超えた分の時間は破棄する
+	if (steps > MAX_STEPS_PER_FRAME)
+	{
+		steps = MAX_STEPS_PER_FRAME;
+		s_accumulator = 0.0;
+	}
+
+	s_alpha = Min(s_accumulator / FIXED_DELTA_TIME, 1.0);
+	return steps;
+}
+
+void SimulationClock::BeginTick()
+{
+	s_inTick = true;
+}
+
+void SimulationClock::EndTick()
+{
+	s_inTick = false;
+	++s_tickCount;
+}
+
+double SimulationClock::DeltaTime()
+{
+	return s_inTick ? FIXED_DELTA_TIME : Scene::DeltaTime();
+}
+
+double SimulationClock::Time()
+{
+	return s_tickCount * FIXED_DELTA_TIME;
+}
+
+double SimulationClock::GetAlpha()
+{
+	return s_alpha;
+}
+
+uint64 SimulationClock::TickCount()
+{
+	return s_tickCount;
+}
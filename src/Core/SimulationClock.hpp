@@ -0,0 +1,34 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// ゲームプレイ用の固定タイムステップ時計
+// 描画フレームの経過時間を蓄積し、固定間隔のティックに分割してシミュレーションを進める
+class SimulationClock
+{
+public:
+	// 1ティックごとに適用している減衰・補間係数（Lerp や *= 0.98 など）は 60fps 前提で調整されているため 60Hz
+	static constexpr double TICK_RATE = 60.0;
+	static constexpr double FIXED_DELTA_TIME = 1.0 / TICK_RATE;
+	static constexpr int MAX_STEPS_PER_FRAME = 8;  // ヒッチ時の追いつき上限（超過分は切り捨て）
+
+	// シーン開始時に蓄積時間とシミュレーション時間をリセット
+	static void Reset();
+
+	// 描画フレームの経過時間を蓄積し、このフレームで実行するティック数を返す
+	static int Advance(double frameDeltaTime);
+
+	// ティックの開始・終了（この間は DeltaTime() が固定値を返す）
+	static void BeginTick();
+	static void EndTick();
+
+	// ティック中は固定値、それ以外は Scene::DeltaTime()
+	static double DeltaTime();
+
+	// シミュレーション開始からの経過時間（ティック単位で進む）
+	static double Time();
+
+	// 直前のティックから次のティックまでの補間係数 [0, 1)
+	static double GetAlpha();
+
+	static uint64 TickCount();
+};
@@ -0,0 +1,29 @@
+﻿#include "SystemTimings.hpp"
+
+StringView SystemTimings::GetName(SimulationSystem system)
+{
+	switch (system)
+	{
+	case SimulationSystem::DayNight:       return U"DayNight";
+	case SimulationSystem::Player:         return U"Player";
+	case SimulationSystem::Collision:      return U"Collision";
+	case SimulationSystem::Blocks:         return U"Blocks";
+	case SimulationSystem::Collections:    return U"Collections";
+	case SimulationSystem::HUD:            return U"HUD";
+	case SimulationSystem::Enemies:        return U"Enemies";
+	case SimulationSystem::EnemyCollision: return U"EnemyCollision";
+	case SimulationSystem::Effects:        return U"Effects";
+	case SimulationSystem::Stage:          return U"Stage";
+	default:                               return U"Unknown";
+	}
+}
+
+double SystemTimings::getTotal() const
+{
+	double total = 0.0;
+	for (const double microseconds : m_microseconds)
+	{
+		total += microseconds;
+	}
+	return total;
+}
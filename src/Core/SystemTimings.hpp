@@ -0,0 +1,73 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include <array>
+#include "TraceCapture.hpp"
+
+// 計測対象のシミュレーションシステム
+enum class SimulationSystem : uint8
+{
+	DayNight,
+	Player,
+	Collision,
+	Blocks,
+	Collections,
+	HUD,
+	Enemies,
+	EnemyCollision,
+	Effects,
+	Stage,
+
+	Count
+};
+
+// シミュレーションシステムごとの処理時間の累計（マイクロ秒）
+class SystemTimings
+{
+public:
+	static constexpr size_t SYSTEM_COUNT = static_cast<size_t>(SimulationSystem::Count);
+
+	static StringView GetName(SimulationSystem system);
+
+	void add(SimulationSystem system, double microseconds)
+	{
+		m_microseconds[static_cast<size_t>(system)] += microseconds;
+	}
+
+	double get(SimulationSystem system) const
+	{
+		return m_microseconds[static_cast<size_t>(system)];
+	}
+
+	double getTotal() const;
+	void clear() { m_microseconds.fill(0.0); }
+
+private:
+	std::array<double, SYSTEM_COUNT> m_microseconds{};
+};
+
+// スコープ内の処理時間を SystemTimings に加算する
+class ScopedSystemTimer
+{
+public:
+	ScopedSystemTimer(SystemTimings& timings, SimulationSystem system)
+		: m_timings(timings)
+		, m_system(system)
+		, m_startNanosec(Time::GetNanosec())
+		, m_trace(SystemTimings::GetName(system))
+	{
+	}
+
+	~ScopedSystemTimer()
+	{
+		m_timings.add(m_system, (Time::GetNanosec() - m_startNanosec) / 1000.0);
+	}
+
+	ScopedSystemTimer(const ScopedSystemTimer&) = delete;
+	ScopedSystemTimer& operator=(const ScopedSystemTimer&) = delete;
+
+private:
+	SystemTimings& m_timings;
+	SimulationSystem m_system;
+	uint64 m_startNanosec;
+	ScopedTrace m_trace;
+};
@@ -0,0 +1,60 @@
+﻿#include "TextureCache.hpp"
+
+HashTable<FilePath, TextureCache::Entry> TextureCache::s_entries;
+size_t TextureCache::s_loadCount = 0;
+
+Texture TextureCache::Acquire(FilePathView path)
+{
+	const FilePath key{ path };
+
+	auto it = s_entries.find(key);
+	if (it == s_entries.end())
+	{
+		Texture texture{ key };
+		if (!texture)
+		{
+			return Texture{};
+		}
+
+		++s_loadCount;
+		it = s_entries.emplace(key, Entry{ texture, 0 }).first;
+	}
+
+	++it->second.refCount;
+	return it->second.texture;
+}
+
+void TextureCache::Release(FilePathView path)
+{
+	auto it = s_entries.find(FilePath{ path });
+	if (it != s_entries.end() && it->second.refCount > 0)
+	{
+		--it->second.refCount;
+	}
+}
+
+void TextureCache::TrimUnused()
+{
+	// 利用者が手放していても Texture のコピーが残っていれば GPU 側の解放はその破棄時になる
+	for (auto it = s_entries.begin(); it != s_entries.end();)
+	{
+		if (it->second.refCount == 0)
+		{
+			it = s_entries.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+void TextureCache::Clear()
+{
+	s_entries.clear();
+}
+
+size_t TextureCache::GetCachedCount()
+{
+	return s_entries.size();
+}
@@ -0,0 +1,82 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// パスをキーにしたプロセス全体のテクスチャキャッシュ
+// 同じ画像は1回だけ読み込み、利用者ごとの参照カウントで共有する
+// 参照が0になったテクスチャはすぐには破棄せず、TrimUnused() で解放する（リトライ時の再読み込みを防ぐ）
+class TextureCache
+{
+public:
+	// 読み込み済みなら共有し、参照カウントを増やす（失敗時は空のテクスチャを返し、カウントしない）
+	static Texture Acquire(FilePathView path);
+	static void Release(FilePathView path);
+
+	// 参照されていないテクスチャを解放する
+	static void TrimUnused();
+
+	// エンジン終了前にすべて解放する
+	static void Clear();
+
+	static size_t GetCachedCount();
+	static size_t GetLoadCount() { return s_loadCount; }
+
+private:
+	struct Entry
+	{
+		Texture texture;
+		size_t refCount = 0;
+	};
+
+	static HashTable<FilePath, Entry> s_entries;
+	static size_t s_loadCount;  // 実際にファイルから読み込んだ回数
+};
+
+// 取得したテクスチャの参照をまとめて保持し、破棄時にキャッシュへ返す
+class TextureLease
+{
+public:
+	TextureLease() = default;
+	~TextureLease() { releaseAll(); }
+
+	TextureLease(const TextureLease&) = delete;
+	TextureLease& operator=(const TextureLease&) = delete;
+
+	TextureLease(TextureLease&& other) noexcept
+		: m_paths(std::move(other.m_paths))
+	{
+		other.m_paths.clear();
+	}
+
+	TextureLease& operator=(TextureLease&& other) noexcept
+	{
+		if (this != &other)
+		{
+			releaseAll();
+			m_paths = std::move(other.m_paths);
+			other.m_paths.clear();
+		}
+		return *this;
+	}
+
+	Texture acquire(FilePathView path)
+	{
+		Texture texture = TextureCache::Acquire(path);
+		if (texture)
+		{
+			m_paths.emplace_back(path);
+		}
+		return texture;
+	}
+
+	void releaseAll()
+	{
+		for (const auto& path : m_paths)
+		{
+			TextureCache::Release(path);
+		}
+		m_paths.clear();
+	}
+
+private:
+	Array<FilePath> m_paths;
+};
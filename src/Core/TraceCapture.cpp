@@ -0,0 +1,137 @@
+﻿#include "TraceCapture.hpp"
+#include <mutex>
+
+namespace
+{
+	struct TraceEvent
+	{
+		StringView name;
+		uint64 nanosec;
+		TraceCapture::Phase phase;
+	};
+
+	// スレッドごとの固定容量のバッファ
+	// 書き込むのは所有スレッドだけで、書き出し側は count（release で公開）までしか読まない
+	// 記録を始め直すたびに s_captureEpoch を進め、所有スレッドが次の記録時に自分で空にする（他スレッドからは消さない）
+	struct ThreadBuffer
+	{
+		uint32 threadIndex = 0;
+		std::unique_ptr<TraceEvent[]> events;
+		std::atomic<uint32> count{ 0 };
+		std::atomic<uint32> epoch{ 0 };    // events が属する記録の番号
+		std::atomic<uint32> dropped{ 0 };  // 容量を超えて捨てたイベントの数
+	};
+
+	constexpr uint32 EVENT_CAPACITY = 1 << 16;
+
+	// バッファの登録（スレッドごとに最初の1回だけロックする）
+	std::mutex s_registryMutex;
+	Array<std::unique_ptr<ThreadBuffer>> s_threadBuffers;
+	thread_local ThreadBuffer* t_threadBuffer = nullptr;
+
+	std::atomic<uint32> s_captureEpoch{ 0 };
+	uint64 s_captureStartNanosec = 0;  // Start() / Stop() を呼ぶスレッドだけが使う
+
+	ThreadBuffer& GetThreadBuffer()
+	{
+		if (!t_threadBuffer)
+		{
+			auto buffer = std::make_unique<ThreadBuffer>();
+			buffer->events = std::make_unique<TraceEvent[]>(EVENT_CAPACITY);
+
+			std::lock_guard lock{ s_registryMutex };
+			buffer->threadIndex = static_cast<uint32>(s_threadBuffers.size());
+			t_threadBuffer = buffer.get();
+			s_threadBuffers.push_back(std::move(buffer));
+		}
+		return *t_threadBuffer;
+	}
+}
+
+std::atomic<bool> TraceCapture::s_capturing{ false };
+
+void TraceCapture::Start()
+{
+	if (IsCapturing()) return;
+
+	// 前の記録のイベントは各スレッドが次に記録するときに捨てる
+	s_captureEpoch.fetch_add(1, std::memory_order_release);
+	s_captureStartNanosec = Time::GetNanosec();
+	s_capturing.store(true, std::memory_order_release);
+}
+
+bool TraceCapture::Stop(FilePathView path)
+{
+	if (!IsCapturing()) return false;
+
+	s_capturing.store(false, std::memory_order_release);
+	const uint32 epoch = s_captureEpoch.load(std::memory_order_acquire);
+
+	FileSystem::CreateParentDirectories(path);
+
+	TextWriter writer{ path };
+	if (!writer)
+	{
+		return false;
+	}
+
+	// 1イベント1行で書き出す
+	writer.writeln(U"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+	bool first = true;
+	uint32 droppedCount = 0;
+	std::lock_guard lock{ s_registryMutex };
+	for (const auto& buffer : s_threadBuffers)
+	{
+		// この記録中に一度も記録していないスレッドのバッファは前の記録のまま
+		if (buffer->epoch.load(std::memory_order_acquire) != epoch) continue;
+
+		// 停止と同時に追記中のイベントは count に含まれないので読まない
+		const uint32 count = buffer->count.load(std::memory_order_acquire);
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const TraceEvent& event = buffer->events[i];
+			const double timestamp = (event.nanosec - s_captureStartNanosec) / 1000.0;
+			writer.writeln(U"{}{{\"name\":\"{}\",\"ph\":\"{}\",\"ts\":{:.3f},\"pid\":1,\"tid\":{}}}"_fmt(
+				(first ? U"" : U","),
+				event.name,
+				static_cast<char32>(event.phase),
+				timestamp,
+				buffer->threadIndex));
+			first = false;
+		}
+		droppedCount += buffer->dropped.load(std::memory_order_relaxed);
+	}
+
+	writer.writeln(U"],\"otherData\":{{\"droppedEvents\":{}}}}}"_fmt(droppedCount));
+	return true;
+}
+
+void TraceCapture::Record(StringView name, Phase phase, uint64 nanosec)
+{
+	ThreadBuffer& buffer = GetThreadBuffer();
+
+	// 新しい記録の最初のイベントなら、前の記録のイベントを捨てる
+	const uint32 epoch = s_captureEpoch.load(std::memory_order_acquire);
+	if (buffer.epoch.load(std::memory_order_relaxed) != epoch)
+	{
+		buffer.count.store(0, std::memory_order_relaxed);
+		buffer.dropped.store(0, std::memory_order_relaxed);
+		buffer.epoch.store(epoch, std::memory_order_release);
+	}
+
+	const uint32 index = buffer.count.load(std::memory_order_relaxed);
+	if (EVENT_CAPACITY <= index)
+	{
+		buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer.events[index] = TraceEvent{ name, nanosec, phase };
+	buffer.count.store(index + 1, std::memory_order_release);
+}
+
+FilePath TraceCapture::MakeDefaultPath()
+{
+	return U"Traces/trace_{}.json"_fmt(DateTime::Now().format(U"yyyyMMdd_HHmmss"));
+}
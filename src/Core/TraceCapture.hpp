@@ -0,0 +1,66 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include <atomic>
+
+// Chrome の trace_event 形式（chrome://tracing, Perfetto）で読めるタイムラインの記録
+// 記録はスレッドごとの固定容量のバッファに追記するだけ（どのスレッドからでもよく、あふれた分は捨てる）
+// 停止していれば ScopedTrace はフラグを1回読むだけになる
+class TraceCapture
+{
+public:
+	enum class Phase : char
+	{
+		Begin = 'B',
+		End = 'E',
+	};
+
+	static void Start();
+
+	// 記録を止めて JSON に書き出す（記録中でなければ何もしない）
+	static bool Stop(FilePathView path);
+
+	static bool IsCapturing()
+	{
+		return s_capturing.load(std::memory_order_relaxed);
+	}
+
+	// name は文字列リテラルなど、書き出しまで有効な文字列を渡す
+	static void Record(StringView name, Phase phase, uint64 nanosec);
+
+	// 既定の書き出し先（Traces/trace_<日時>.json）
+	static FilePath MakeDefaultPath();
+
+private:
+	static std::atomic<bool> s_capturing;
+};
+
+// スコープの開始・終了をイベントとして記録する
+class ScopedTrace
+{
+public:
+	explicit ScopedTrace(StringView name)
+		: m_name(name)
+		, m_recording(TraceCapture::IsCapturing())
+	{
+		if (m_recording)
+		{
+			TraceCapture::Record(m_name, TraceCapture::Phase::Begin, Time::GetNanosec());
+		}
+	}
+
+	~ScopedTrace()
+	{
+		// 開始を記録したスコープだけ終了を記録する（途中で記録が止まっても対応が崩れない）
+		if (m_recording)
+		{
+			TraceCapture::Record(m_name, TraceCapture::Phase::End, Time::GetNanosec());
+		}
+	}
+
+	ScopedTrace(const ScopedTrace&) = delete;
+	ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+	StringView m_name;
+	bool m_recording;
+};
@@ -0,0 +1,116 @@
+﻿#include "ParticlePool.hpp"
+
+ParticlePool::ParticlePool(size_t capacity, const Motion& motion)
+	: m_motion(motion)
+	, m_count(0)
+	, m_positionX(capacity, 0.0)
+	, m_positionY(capacity, 0.0)
+	, m_velocityX(capacity, 0.0)
+	, m_velocityY(capacity, 0.0)
+	, m_rotation(capacity, 0.0)
+	, m_rotationSpeed(capacity, 0.0)
+	, m_life(capacity, 0.0)
+	, m_maxLife(capacity, 1.0)
+	, m_size(capacity, 0.0)
+	, m_color(capacity, ColorF(1.0))
+	, m_variant(capacity, 0)
+	, m_flags(capacity, 0)
+{
+}
+
+bool ParticlePool::spawn(const Particle& particle)
+{
+	if (m_count >= capacity()) return false;
+
+	const size_t index = m_count++;
+	m_positionX[index] = particle.position.x;
+	m_positionY[index] = particle.position.y;
+	m_velocityX[index] = particle.velocity.x;
+	m_velocityY[index] = particle.velocity.y;
+	m_rotation[index] = particle.rotation;
+	m_rotationSpeed[index] = particle.rotationSpeed;
+	m_life[index] = particle.life;
+	m_maxLife[index] = (particle.life > 0.0) ? particle.life : 1.0;
+	m_size[index] = particle.size;
+	m_color[index] = particle.color;
+	m_variant[index] = particle.variant;
+	m_flags[index] = 0;
+	return true;
+}
+
+void ParticlePool::update(double deltaTime)
+{
+	const size_t count = m_count;
+
+	double* const positionX = m_positionX.data();
+	double* const positionY = m_positionY.data();
+	double* const velocityX = m_velocityX.data();
+	double* const velocityY = m_velocityY.data();
+	double* const rotation = m_rotation.data();
+	const double* const rotationSpeed = m_rotationSpeed.data();
+	double* const life = m_life.data();
+	double* const size = m_size.data();
+
+	const double gravityX = m_motion.gravity.x * deltaTime;
+	const double gravityY = m_motion.gravity.y * deltaTime;
+	const double dragX = m_motion.drag.x;
+	const double dragY = m_motion.drag.y;
+	const double sizeScale = m_motion.sizeScale;
+
+	// 分岐のない更新（移動 → 重力 → 空気抵抗 → 回転・寿命・サイズ）
+	for (size_t i = 0; i < count; ++i)
+	{
+		positionX[i] += velocityX[i] * deltaTime;
+		positionY[i] += velocityY[i] * deltaTime;
+		velocityX[i] = (velocityX[i] + gravityX) * dragX;
+		velocityY[i] = (velocityY[i] + gravityY) * dragY;
+		rotation[i] += rotationSpeed[i] * deltaTime;
+		life[i] -= deltaTime;
+		size[i] *= sizeScale;
+	}
+
+	// 消滅したパーティクルを末尾と入れ替えて取り除く
+	for (size_t i = 0; i < m_count;)
+	{
+		if (m_life[i] <= 0.0 || m_size[i] <= m_motion.minSize || m_motion.maxY < m_positionY[i])
+		{
+			removeAt(i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+ParticlePool::Columns ParticlePool::columns()
+{
+	return Columns{
+		m_positionX.data(),
+		m_positionY.data(),
+		m_velocityX.data(),
+		m_velocityY.data(),
+		m_rotationSpeed.data(),
+		m_size.data(),
+		m_flags.data()
+	};
+}
+
+void ParticlePool::removeAt(size_t index)
+{
+	const size_t last = --m_count;
+	if (index == last) return;
+
+	m_positionX[index] = m_positionX[last];
+	m_positionY[index] = m_positionY[last];
+	m_velocityX[index] = m_velocityX[last];
+	m_velocityY[index] = m_velocityY[last];
+	m_rotation[index] = m_rotation[last];
+	m_rotationSpeed[index] = m_rotationSpeed[last];
+	m_life[index] = m_life[last];
+	m_maxLife[index] = m_maxLife[last];
+	m_size[index] = m_size[last];
+	m_color[index] = m_color[last];
+	m_variant[index] = m_variant[last];
+	m_flags[index] = m_flags[last];
+}
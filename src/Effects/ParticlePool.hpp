@@ -0,0 +1,89 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// 固定容量・SoA（成分ごとの配列）のパーティクルプール
+// 生成時にメモリを確保せず、消滅したパーティクルは末尾と入れ替えて詰める（並び順は保たない）
+// update() は全要素に同じ式を適用するだけのループなので、コンパイラの自動ベクトル化が効く
+class ParticlePool
+{
+public:
+	// 更新カーネルの設定（プール内で共通）
+	struct Motion
+	{
+		Vec2 gravity = Vec2::Zero();  // 加速度（px/s^2）
+		Vec2 drag = Vec2::One();      // 更新1回ごとに速度へ掛ける係数
+		double sizeScale = 1.0;       // 更新1回ごとにサイズへ掛ける係数
+		double minSize = 0.0;         // サイズがこれ以下になったら消滅
+		double maxY = Math::Inf;      // これより下へ出たら消滅
+	};
+
+	// 生成時の初期値
+	struct Particle
+	{
+		Vec2 position = Vec2::Zero();
+		Vec2 velocity = Vec2::Zero();
+		double life = 1.0;
+		double size = 1.0;
+		double rotation = 0.0;
+		double rotationSpeed = 0.0;
+		ColorF color = ColorF(1.0);
+		uint8 variant = 0;  // 描画側で使う種類（テクスチャの番号など）
+	};
+
+	// 独自の挙動を加える場合の成分ごとの配列（先頭から size() 個が有効）
+	struct Columns
+	{
+		double* positionX;
+		double* positionY;
+		double* velocityX;
+		double* velocityY;
+		double* rotationSpeed;
+		double* size;
+		uint8* flags;  // 呼び出し側で自由に使うフラグ（生成時は 0）
+	};
+
+	ParticlePool() = default;
+	ParticlePool(size_t capacity, const Motion& motion);
+
+	// 空きがなければ false（既存のパーティクルは上書きしない）
+	bool spawn(const Particle& particle);
+
+	// 全パーティクルを deltaTime 進め、消滅したものを取り除く
+	void update(double deltaTime);
+
+	void clear() { m_count = 0; }
+
+	size_t size() const { return m_count; }
+	size_t capacity() const { return m_life.size(); }
+	bool isEmpty() const { return (m_count == 0); }
+
+	Columns columns();
+
+	// 描画用の取得（index は size() 未満）
+	Vec2 getPosition(size_t index) const { return Vec2(m_positionX[index], m_positionY[index]); }
+	double getLifeRatio(size_t index) const { return (m_life[index] / m_maxLife[index]); }
+	double getLife(size_t index) const { return m_life[index]; }
+	double getSize(size_t index) const { return m_size[index]; }
+	double getRotation(size_t index) const { return m_rotation[index]; }
+	const ColorF& getColor(size_t index) const { return m_color[index]; }
+	uint8 getVariant(size_t index) const { return m_variant[index]; }
+
+private:
+	Motion m_motion;
+	size_t m_count = 0;
+
+	Array<double> m_positionX;
+	Array<double> m_positionY;
+	Array<double> m_velocityX;
+	Array<double> m_velocityY;
+	Array<double> m_rotation;
+	Array<double> m_rotationSpeed;
+	Array<double> m_life;
+	Array<double> m_maxLife;
+	Array<double> m_size;
+	Array<ColorF> m_color;
+	Array<uint8> m_variant;
+	Array<uint8> m_flags;
+
+	void removeAt(size_t index);
+};
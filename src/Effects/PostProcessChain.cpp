@@ -0,0 +1,129 @@
+﻿#include "PostProcessChain.hpp"
+
+void PostProcessChain::init()
+{
+	ensureTargets();
+
+	m_fusedShader = HLSL(U"Shaders/PostProcess.hlsl", U"PS");
+	if (!m_fusedShader) Print << U"Failed to load PostProcess shader";
+}
+
+const RenderTexture& PostProcessChain::beginCapture()
+{
+	ensureTargets();
+
+	m_targets[0].clear(Scene::GetBackground());
+	return m_targets[0];
+}
+
+void PostProcessChain::draw()
+{
+	ScratchArray<Pass> passes = FrameScratch::MakeArray<Pass>();
+	buildPasses(passes);
+	m_lastPassCount = Max<size_t>(passes.size(), 1);
+
+	if (passes.empty())
+	{
+		m_targets[0].draw();
+		return;
+	}
+
+	// 最後のパス以外は作業用のテクスチャへ描き、次のパスの入力にする
+	size_t sourceIndex = 0;
+	for (size_t i = 0; i < passes.size(); ++i)
+	{
+		const RenderTexture& source = m_targets[sourceIndex];
+
+		if (i + 1 < passes.size())
+		{
+			RenderTexture& destination = m_targets[1 - sourceIndex];
+			{
+				const ScopedRenderTarget2D target(destination);
+				const ScopedRenderStates2D blend{ BlendState::Opaque };
+				drawPass(passes[i], source);
+			}
+			sourceIndex = 1 - sourceIndex;
+		}
+		else
+		{
+			drawPass(passes[i], source);
+		}
+	}
+}
+
+void PostProcessChain::ensureTargets()
+{
+	// 画面サイズが変わったときだけ作り直す
+	if (m_targets[0] && m_targets[0].size() == Scene::Size()) return;
+
+	for (auto& target : m_targets)
+	{
+		target = RenderTexture(Scene::Size());
+	}
+}
+
+void PostProcessChain::buildPasses(ScratchArray<Pass>& passes)
+{
+	FusedParams& params = m_fusedParams.get();
+	uint32 flags = 0;
+
+	const auto flushFused = [&]() {
+		if (flags != 0)
+		{
+			passes.push_back(Pass{ flags, nullptr });
+			flags = 0;
+		}
+	};
+
+	for (const auto& stage : m_stages)
+	{
+		if (stage.isEnabled && !stage.isEnabled()) continue;
+
+		if (stage.fused)
+		{
+			if (!m_fusedShader) continue;
+
+			// シェーダー内の適用順より前の処理が続いた場合は別のパスに分ける
+			const uint32 flag = static_cast<uint32>(*stage.fused);
+			if (flag <= flags)
+			{
+				flushFused();
+			}
+
+			if (stage.writeParams)
+			{
+				stage.writeParams(params);
+			}
+			flags |= flag;
+		}
+		else if (stage.shader)
+		{
+			flushFused();
+			passes.push_back(Pass{ 0, &stage });
+		}
+	}
+
+	flushFused();
+}
+
+void PostProcessChain::drawPass(const Pass& pass, const RenderTexture& source)
+{
+	if (pass.fusedFlags != 0)
+	{
+		m_fusedParams->flags = pass.fusedFlags;
+		m_fusedParams->time = static_cast<float>(Scene::Time());
+		m_fusedParams->invTextureSize = Float2{ 1.0f / source.width(), 1.0f / source.height() };
+
+		Graphics2D::SetConstantBuffer(ShaderStage::Pixel, 1, m_fusedParams);
+		const ScopedCustomShader2D shader(m_fusedShader);
+		source.draw();
+		return;
+	}
+
+	if (pass.stage->bindConstants)
+	{
+		pass.stage->bindConstants();
+	}
+	const ScopedCustomShader2D shader(pass.stage->shader);
+	source.draw();
+}
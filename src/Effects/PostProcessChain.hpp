@@ -0,0 +1,102 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include "../Core/MemoryArena.hpp"
+
+// 画面全体のポストエフェクトを登録順に適用するチェーン
+// シーンの描画先と作業用の RenderTexture を持ち続けて交互に使い、毎フレームの確保をしない
+// 続けて並んだ統合ステージは PostProcess.hlsl の1パスにまとめ、最後のパスは直接画面へ描く
+class PostProcessChain
+{
+public:
+	// PostProcess.hlsl の1パスにまとめられる処理（値の小さい順にシェーダー内で適用する）
+	enum class FusedStage : uint32
+	{
+		Shockwave = (1u << 0),
+		Wave      = (1u << 1),
+		Chromatic = (1u << 2),
+		DayNight  = (1u << 3),
+	};
+
+	// 1パスで同時に描ける衝撃波の数（PostProcess.hlsl の MAX_SHOCKWAVES と同じ値）
+	static constexpr size_t MAX_SHOCKWAVES = 8;
+
+	struct ShockwaveParams
+	{
+		Float2 center = { 0.5f, 0.5f };  // 画面に対する UV 座標
+		float radius = 0.0f;
+		float thickness = 0.05f;
+		float force = 0.0f;
+		float padding[3] = {};
+	};
+
+	// 統合パスの定数バッファ（PostProcess.hlsl の PostProcessParams と同じ並び）
+	struct FusedParams
+	{
+		uint32 flags = 0;  // 有効な FusedStage（draw() が設定する）
+		float time = 0.0f;
+		Float2 invTextureSize = { 0.0f, 0.0f };
+
+		float waveAmplitude = 10.0f;
+		float waveFrequency = 20.0f;
+		float waveSpeed = 3.0f;
+		float chromaticIntensity = 0.5f;
+
+		float chromaticRadialStrength = 0.5f;
+		uint32 shockwaveCount = 0;
+		float padding[2] = {};
+
+		float timeOfDay = 0.0f;
+		float moonlightIntensity = 0.0f;
+		float phaseBlend = 0.0f;
+		float starsBonus = 0.0f;
+
+		std::array<ShockwaveParams, MAX_SHOCKWAVES> shockwaves{};
+	};
+
+	struct Stage
+	{
+		String name;
+		std::function<bool()> isEnabled;
+
+		// 統合ステージ：有効なフレームに writeParams で自分の値を書き込む
+		Optional<FusedStage> fused;
+		std::function<void(FusedParams&)> writeParams;
+
+		// 単独ステージ（周囲を何度もサンプリングする Glow など）：自分のシェーダーで1パス描く
+		PixelShader shader;
+		std::function<void()> bindConstants;
+	};
+
+	void init();
+
+	void addStage(Stage stage) { m_stages.push_back(std::move(stage)); }
+	void clearStages() { m_stages.clear(); }
+
+	// シーンの描画先（背景色でクリア済み）。ScopedRenderTarget2D に渡して描く
+	const RenderTexture& beginCapture();
+
+	// 有効なステージを登録順に適用して画面へ描く
+	void draw();
+
+	// 直前の draw() で描いた全画面パスの数
+	size_t getLastPassCount() const { return m_lastPassCount; }
+
+private:
+	struct Pass
+	{
+		uint32 fusedFlags = 0;            // 0 以外なら統合パス
+		const Stage* stage = nullptr;     // 単独パスのステージ
+	};
+
+	Array<Stage> m_stages;
+
+	std::array<RenderTexture, 2> m_targets;  // [0] から描き始め、パスごとに入れ替える
+	PixelShader m_fusedShader;
+	ConstantBuffer<FusedParams> m_fusedParams;
+	size_t m_lastPassCount = 0;
+
+	void ensureTargets();
+	// 毎フレーム組み直すのでフレーム用の作業領域に積む
+	void buildPasses(ScratchArray<Pass>& passes);
+	void drawPass(const Pass& pass, const RenderTexture& source);
+};
@@ -1,185 +1,149 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
+#include "PostProcessChain.hpp"
 
+// 画面全体のエフェクトの状態（描画は PostProcessChain に登録したステージが行う）
+// 有効なエフェクトは全て重ねて適用する（Glow → 衝撃波 → 波 → 色収差）
+// 衝撃波は MAX_SHOCKWAVES 個まで同時に存在でき、いくつあっても統合パス1回で描く
 class ShaderEffects
 {
 private:
-	RenderTexture m_renderTexture;
 	PixelShader m_glowShader;
-	PixelShader m_waveShader;
-	PixelShader m_chromaticShader;
-	PixelShader m_shockwaveShader;
 
-	struct WaveParams
+	// 同時に存在する衝撃波（先頭から m_shockwaveCount 個が有効）
+	struct Shockwave
 	{
-		float time = 0.0f;
-		float amplitude = 10.0f;
-		float frequency = 20.0f;
-		float speed = 3.0f;
+		PostProcessChain::ShockwaveParams params;
+		double time = 0.0;
 	};
 
-	struct ChromaticParams
-	{
-		float intensity = 0.5f;
-		float radialStrength = 0.5f;
-		float padding[2] = {};
-	};
-
-	struct ShockwaveParams
-	{
-		Float2 center = { 0.5f, 0.5f };
-		float radius = 0.0f;
-		float thickness = 0.05f;
-		float force = 0.1f;
-		float padding[3] = {};
-	};
-
-	ConstantBuffer<WaveParams> m_waveBuffer;
-	ConstantBuffer<ChromaticParams> m_chromaticBuffer;
-	ConstantBuffer<ShockwaveParams> m_shockwaveBuffer;
+	std::array<Shockwave, PostProcessChain::MAX_SHOCKWAVES> m_shockwaves{};
+	size_t m_shockwaveCount = 0;
+	float m_chromaticIntensity = 0.5f;
+	float m_chromaticRadialStrength = 0.5f;
 
 	bool m_glowActive = false;
 	bool m_waveActive = false;
 	bool m_chromaticActive = false;
-	bool m_shockwaveActive = false;
-	bool m_isCapturing = false;
 
-	double m_shockwaveTime = 0.0;
 	static constexpr double SHOCKWAVE_DURATION = 1.0;
 
+	static constexpr float WAVE_AMPLITUDE = 10.0f;
+	static constexpr float WAVE_FREQUENCY = 20.0f;
+	static constexpr float WAVE_SPEED = 3.0f;
+
 public:
 	void init()
 	{
-		m_renderTexture = RenderTexture(Scene::Size());
 		m_glowShader = HLSL(U"Shaders/Glow.hlsl", U"PS");
-		m_waveShader = HLSL(U"Shaders/Wave.hlsl", U"PS");
-		m_chromaticShader = HLSL(U"Shaders/ChromaticAberration.hlsl", U"PS");
-		m_shockwaveShader = HLSL(U"Shaders/Shockwave.hlsl", U"PS");
 
 		if (!m_glowShader) Print << U"Failed to load Glow shader";
-		if (!m_waveShader) Print << U"Failed to load Wave shader";
-		if (!m_chromaticShader) Print << U"Failed to load Chromatic shader";
-		if (!m_shockwaveShader) Print << U"Failed to load Shockwave shader";
 	}
 
-	void beginCapture()
+	// 各エフェクトをチェーンに登録する（有効かどうかは毎フレーム問い合わせる）
+	void registerStages(PostProcessChain& chain)
 	{
-		m_renderTexture.clear(Scene::GetBackground());
-		m_isCapturing = true;
+		chain.addStage(PostProcessChain::Stage{
+			.name = U"Glow",
+			.isEnabled = [this]() { return m_glowActive; },
+			.shader = m_glowShader });
+
+		chain.addStage(PostProcessChain::Stage{
+			.name = U"Shockwave",
+			.isEnabled = [this]() { return (m_shockwaveCount != 0); },
+			.fused = PostProcessChain::FusedStage::Shockwave,
+			.writeParams = [this](PostProcessChain::FusedParams& params) {
+				params.shockwaveCount = static_cast<uint32>(m_shockwaveCount);
+				for (size_t i = 0; i < m_shockwaveCount; ++i)
+				{
+					params.shockwaves[i] = m_shockwaves[i].params;
+				}
+			} });
+
+		chain.addStage(PostProcessChain::Stage{
+			.name = U"Wave",
+			.isEnabled = [this]() { return m_waveActive; },
+			.fused = PostProcessChain::FusedStage::Wave,
+			.writeParams = [](PostProcessChain::FusedParams& params) {
+				params.waveAmplitude = WAVE_AMPLITUDE;
+				params.waveFrequency = WAVE_FREQUENCY;
+				params.waveSpeed = WAVE_SPEED;
+			} });
+
+		chain.addStage(PostProcessChain::Stage{
+			.name = U"Chromatic",
+			.isEnabled = [this]() { return m_chromaticActive; },
+			.fused = PostProcessChain::FusedStage::Chromatic,
+			.writeParams = [this](PostProcessChain::FusedParams& params) {
+				params.chromaticIntensity = m_chromaticIntensity;
+				params.chromaticRadialStrength = m_chromaticRadialStrength;
+			} });
 	}
 
-	RenderTexture& getRenderTarget()
-	{
-		return m_renderTexture;
-	}
+	void enableGlow(bool enable) { m_glowActive = enable; }
+	void enableWave(bool enable) { m_waveActive = enable; }
+	void enableChromatic(bool enable) { m_chromaticActive = enable; }
 
-	void endCaptureAndDraw()
+	// 既存の衝撃波に重ねて追加する（上限に達していたら最も古いものを置き換える）
+	void triggerShockwave(const Vec2& worldPos, const Vec2& cameraOffset)
 	{
-		m_isCapturing = false;
-
-		if (m_shockwaveActive && m_shockwaveShader)
-		{
-			applyShockwave();
-		}
-		else if (m_glowActive && m_glowShader)
-		{
-			applyGlow();
-		}
-		else if (m_chromaticActive && m_chromaticShader)
+		size_t index = m_shockwaveCount;
+		if (index < m_shockwaves.size())
 		{
-			applyChromaticAberration();
-		}
-		else if (m_waveActive && m_waveShader)
-		{
-			applyWave();
+			++m_shockwaveCount;
 		}
 		else
 		{
-			m_renderTexture.draw();
+			index = 0;
+			for (size_t i = 1; i < m_shockwaveCount; ++i)
+			{
+				if (m_shockwaves[index].time < m_shockwaves[i].time)
+				{
+					index = i;
+				}
+			}
 		}
-	}
-
-	void enableGlow(bool enable) { m_glowActive = enable; }
-	void enableWave(bool enable) { m_waveActive = enable; }
-	void enableChromatic(bool enable) { m_chromaticActive = enable; }
-
-	void triggerShockwave(const Vec2& worldPos, const Vec2& cameraOffset)
-	{
-		if (!m_shockwaveShader) return;
 
 		const Vec2 screenPos = worldPos - cameraOffset;
-		m_shockwaveActive = true;
-		m_shockwaveTime = 0.0;
-
-		m_shockwaveBuffer->center = Float2{
-	static_cast<float>(screenPos.x / Scene::Width()),
-	static_cast<float>(screenPos.y / Scene::Height())
+		Shockwave& shockwave = m_shockwaves[index];
+		shockwave.time = 0.0;
+		shockwave.params.center = Float2{
+			static_cast<float>(screenPos.x / Scene::Width()),
+			static_cast<float>(screenPos.y / Scene::Height())
 		};
-		m_shockwaveBuffer->radius = 0.0f;
-		m_shockwaveBuffer->thickness = 0.1f;
-		m_shockwaveBuffer->force = 0.3f;
+		shockwave.params.radius = 0.0f;
+		shockwave.params.thickness = 0.1f;
+		shockwave.params.force = 0.3f;
 	}
 
+	size_t getShockwaveCount() const { return m_shockwaveCount; }
 
 	void update(double deltaTime)
 	{
-		if (m_waveActive)
-		{
-			m_waveBuffer->time = static_cast<float>(Scene::Time());
-			m_waveBuffer->amplitude = 10.0f;
-			m_waveBuffer->frequency = 20.0f;
-			m_waveBuffer->speed = 3.0f;
-		}
-
-		if (m_shockwaveActive)
+		// 終わった衝撃波は末尾と入れ替えて詰める
+		for (size_t i = 0; i < m_shockwaveCount;)
 		{
-			m_shockwaveTime += deltaTime;
-			float progress = static_cast<float>(m_shockwaveTime / SHOCKWAVE_DURATION);
+			Shockwave& shockwave = m_shockwaves[i];
+			shockwave.time += deltaTime;
+			float progress = static_cast<float>(shockwave.time / SHOCKWAVE_DURATION);
 
 			if (progress >= 1.0f)
 			{
-				m_shockwaveActive = false;
+				shockwave = m_shockwaves[--m_shockwaveCount];
 			}
 			else
 			{
-				m_shockwaveBuffer->radius = progress * 0.5f;
-				m_shockwaveBuffer->thickness = 0.05f * (1.0f - progress * 0.5f);
-				m_shockwaveBuffer->force = 0.15f * (1.0f - progress);
+				shockwave.params.radius = progress * 0.5f;
+				shockwave.params.thickness = 0.05f * (1.0f - progress * 0.5f);
+				shockwave.params.force = 0.15f * (1.0f - progress);
+				++i;
 			}
 		}
 	}
 
 	void setChromaticIntensity(float intensity)
 	{
-		m_chromaticBuffer->intensity = intensity;
-		m_chromaticBuffer->radialStrength = intensity * 0.5f;
-	}
-
-private:
-	void applyGlow()
-	{
-		const ScopedCustomShader2D shader(m_glowShader);
-		m_renderTexture.draw();
-	}
-
-	void applyWave()
-	{
-		Graphics2D::SetConstantBuffer(ShaderStage::Pixel, 1, m_waveBuffer); 
-		const ScopedCustomShader2D shader(m_waveShader);
-		m_renderTexture.draw();
-	}
-
-	void applyChromaticAberration()
-	{
-		Graphics2D::SetConstantBuffer(ShaderStage::Pixel, 1, m_chromaticBuffer);
-		const ScopedCustomShader2D shader(m_chromaticShader);
-		m_renderTexture.draw();
-	}
-
-	void applyShockwave()
-	{
-		Graphics2D::SetConstantBuffer(ShaderStage::Pixel, 1, m_shockwaveBuffer);
-		const ScopedCustomShader2D shader(m_shockwaveShader);
-		m_renderTexture.draw();
+		m_chromaticIntensity = intensity;
+		m_chromaticRadialStrength = intensity * 0.5f;
 	}
 };
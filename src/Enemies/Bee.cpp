@@ -1,5 +1,6 @@
 ﻿#include "Bee.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 Bee::Bee(const Vec2& startPosition)
 	: EnemyBase(EnemyType::Bee, startPosition)
@@ -56,7 +57,7 @@ void Bee::update()
 	// Beeは重力の影響を受けないので、独自の物理更新
 	if (m_isFlying)
 	{
-		const double deltaTime = Scene::DeltaTime();
+		const double deltaTime = SimulationClock::DeltaTime();
 		m_position += m_velocity * deltaTime;
 		updateCollisionRect();
 	}
@@ -124,29 +125,13 @@ void Bee::draw() const
 
 void Bee::loadTextures()
 {
-	m_textures.clear();
+	const ScopedTrace trace{ U"Bee::loadTextures" };
 
-	const String basePath = U"Sprites/Enemies/";
-	Array<String> textureNames = {
-		U"bee_rest",
-		U"bee_a",
-		U"bee_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	loadSprites({
+		{ EnemySprite::Rest, U"bee_rest" },
+		{ EnemySprite::FrameA, U"bee_a" },
+		{ EnemySprite::FrameB, U"bee_b" }
+	});
 }
 
 void Bee::setState(EnemyState newState)
@@ -213,7 +198,7 @@ void Bee::updateMovement()
 	updatePatrol();
 
 	// ホバリング効果
-	m_hoverTimer += Scene::DeltaTime();
+	m_hoverTimer += SimulationClock::DeltaTime();
 	const double hoverOffset = std::sin(m_hoverTimer * HOVER_SPEED) * HOVER_AMPLITUDE;
 
 	// ターゲットに向かって移動
@@ -223,10 +208,10 @@ void Bee::updateMovement()
 	if (distance > 20.0)
 	{
 		const Vec2 normalizedDirection = direction.normalized();
-		m_velocity = normalizedDirection * m_moveSpeed * Scene::DeltaTime() * 60.0;
+		m_velocity = normalizedDirection * m_moveSpeed * SimulationClock::DeltaTime() * 60.0;
 
 		// ホバリング効果を追加
-		m_velocity.y += hoverOffset * Scene::DeltaTime() * 30.0;
+		m_velocity.y += hoverOffset * SimulationClock::DeltaTime() * 30.0;
 
 		// 向きを更新
 		m_direction = (direction.x > 0) ? EnemyDirection::Right : EnemyDirection::Left;
@@ -241,23 +226,21 @@ void Bee::updateMovement()
 void Bee::updatePatrol()
 {
 	// パトロール角度を更新
-	m_patrolAngle += Scene::DeltaTime() * 0.5;
+	m_patrolAngle += SimulationClock::DeltaTime() * 0.5;
 	if (m_patrolAngle >= Math::TwoPi)
 	{
 		m_patrolAngle -= Math::TwoPi;
 	}
 }
 
-void Bee::updateChase(const Vec2& playerPosition)
+void Bee::updateChase(const Vec2& chaseTarget, double pathDistance)
 {
-	const double distanceToPlayer = m_position.distanceFrom(playerPosition);
-
-	if (distanceToPlayer <= CHASE_DISTANCE)
+	if (pathDistance <= CHASE_DISTANCE)
 	{
 		m_isChasingPlayer = true;
-		m_targetPosition = playerPosition;
+		m_targetPosition = chaseTarget;
 	}
-	else if (distanceToPlayer > CHASE_DISTANCE * 1.5)
+	else if (pathDistance > CHASE_DISTANCE * 1.5)
 	{
 		m_isChasingPlayer = false;
 		calculatePatrolTarget();
@@ -282,7 +265,7 @@ void Bee::updateFlyBehavior()
 
 void Bee::updateFlattenedBehavior()
 {
-	m_flattenedTimer += Scene::DeltaTime();
+	m_flattenedTimer += SimulationClock::DeltaTime();
 
 	if (m_flattenedTimer >= FLATTENED_DURATION)
 	{
@@ -302,47 +285,12 @@ void Bee::updateHitBehavior()
 
 Texture Bee::getCurrentTexture() const
 {
-	String textureKey;
-
-	switch (m_state)
-	{
-	case EnemyState::Idle:
-		textureKey = U"bee_rest";
-		break;
-	case EnemyState::Walk:  // 飛行状態
-		if (m_isFlying)
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, FLY_ANIMATION_SPEED * 2) < FLY_ANIMATION_SPEED;
-			textureKey = useVariantA ? U"bee_a" : U"bee_b";
-		}
-		else
-		{
-			textureKey = U"bee_rest";
-		}
-		break;
-	case EnemyState::Flattened:
-		textureKey = U"bee_rest";
-		break;
-	case EnemyState::Hit:
-		textureKey = U"bee_rest";
-		break;
-	case EnemyState::Dead:
-		textureKey = U"bee_rest";
-		break;
-	default:
-		textureKey = U"bee_rest";
-		break;
-	}
-
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
-	}
-	else if (m_textures.contains(U"bee_rest"))
+	if (m_state == EnemyState::Walk && m_isFlying)
 	{
-		return m_textures.at(U"bee_rest");
+		const bool useVariantA = std::fmod(m_animationTimer, FLY_ANIMATION_SPEED * 2) < FLY_ANIMATION_SPEED;
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	return Texture{};
+	return getSprite(EnemySprite::Rest);
 }
 
 void Bee::drawFlyTrail() const
@@ -414,29 +362,9 @@ void Bee::drawHitEffect() const
 	}
 }
 
-String Bee::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Walk:
-		if (m_isFlying)
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, FLY_ANIMATION_SPEED * 2) < FLY_ANIMATION_SPEED;
-			return useVariantA ? U"bee_a" : U"bee_b";
-		}
-		return U"bee_rest";
-	case EnemyState::Flattened:
-	case EnemyState::Hit:
-	case EnemyState::Dead:
-	case EnemyState::Idle:
-	default:
-		return U"bee_rest";
-	}
-}
-
 static EnemyAutoRegister _regBee{
 	U"Bee",
-	[](const Vec2& pos) {
-		return std::make_unique<Bee>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<Bee>(pos);
     }
 };
@@ -28,12 +28,14 @@ private:
 	bool m_isFlying;
 
 public:
+	// 種類ごとの性質（EnemyBase の定数を上書き）
+	static constexpr bool TRANSFORMS_AT_NIGHT = true;
+
 	Bee(const Vec2& startPosition);
 	~Bee() override = default;
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"Bee"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
@@ -50,7 +52,7 @@ public:
 	void startFlying();
 	void updateMovement();
 	void updatePatrol();
-	void updateChase(const Vec2& playerPosition);
+	void updateChase(const Vec2& chaseTarget, double pathDistance);  // chaseTarget: 経路上の次の目標, pathDistance: プレイヤーまでの経路長
 	bool isFlying() const { return m_isFlying; }
 
 protected:
@@ -1,13 +1,17 @@
 ﻿#include "EnemyBase.hpp"
 
+std::array<EnemyBase::SpriteSet, EnemyBase::ENEMY_TYPE_COUNT> EnemyBase::s_spriteSets;
+
 EnemyBase::EnemyBase(EnemyType type, const Vec2& startPosition)
 	: m_type(type)
 	, m_position(startPosition)
+	, m_previousTickPosition(startPosition)
 	, m_velocity(Vec2::Zero())
 	, m_state(EnemyState::Idle)
 	, m_direction(EnemyDirection::Left)
 	, m_isActive(true)
 	, m_isAlive(true)
+	, m_isSleeping(false)
 	, m_animationTimer(0.0)
 	, m_stateTimer(0.0)
 	, m_moveSpeed(50.0)
@@ -74,7 +78,7 @@ bool EnemyBase::checkCollisionWith(const RectF& rect) const
 
 void EnemyBase::updatePhysics()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	// 重力適用
 	if (!m_isGrounded)
@@ -91,18 +95,18 @@ void EnemyBase::updatePhysics()
 
 void EnemyBase::applyGravity()
 {
-	m_velocity.y += m_gravity * Scene::DeltaTime();
+	m_velocity.y += m_gravity * SimulationClock::DeltaTime();
 }
 
 void EnemyBase::updateAnimation()
 {
-	m_animationTimer += Scene::DeltaTime();
-	m_stateTimer += Scene::DeltaTime();
+	m_animationTimer += SimulationClock::DeltaTime();
+	m_stateTimer += SimulationClock::DeltaTime();
 
 	// エフェクトタイマー更新
 	if (m_hasEffect)
 	{
-		m_effectTimer += Scene::DeltaTime();
+		m_effectTimer += SimulationClock::DeltaTime();
 	}
 }
 
@@ -133,12 +137,49 @@ String EnemyBase::getStateString() const
 }
 
 
-String EnemyBase::buildTextureKey(const String& action) const
+void EnemyBase::loadSprites(std::initializer_list<std::pair<EnemySprite, StringView>> sprites)
 {
-	return action;
+	SpriteSet& set = s_spriteSets[static_cast<size_t>(m_type)];
+
+	if (!set.isLoaded)
+	{
+		for (const auto& [sprite, textureName] : sprites)
+		{
+			const String filepath = U"Sprites/Enemies/{}.png"_fmt(textureName);
+			const Texture texture = set.lease.acquire(filepath);
+
+			if (texture)
+			{
+				set.sprites[static_cast<size_t>(sprite)] = texture;
+			}
+			else
+			{
+				Print << U"Failed to load texture: " << filepath;
+			}
+		}
+
+		// 描画時に存在チェックをしなくて済むよう、足りないスロットは静止画像で代用
+		const Texture& rest = set.sprites[static_cast<size_t>(EnemySprite::Rest)];
+		for (auto& texture : set.sprites)
+		{
+			if (!texture)
+			{
+				texture = rest;
+			}
+		}
+
+		set.isLoaded = true;
+	}
+
+	m_sprites = set.sprites;
 }
 
-String EnemyBase::buildTextureKey(const String& action, const String& variant) const
+void EnemyBase::ReleaseSpriteSets()
 {
-	return U"{}_{}"_fmt(action, variant);
+	for (auto& set : s_spriteSets)
+	{
+		set.sprites.fill(Texture{});
+		set.lease.releaseAll();
+		set.isLoaded = false;
+	}
 }
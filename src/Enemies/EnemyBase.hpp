@@ -1,5 +1,9 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
+#include "../Core/SimulationClock.hpp"
+#include "../Core/TraceCapture.hpp"
+#include "../Core/TextureCache.hpp"
+#include <array>
 
 // 敵の種類（拡張版）
 enum class EnemyType
@@ -31,6 +35,29 @@ enum class EnemyDirection
 	Right
 };
 
+// 敵のハンドル（EnemyPool のスロット番号と世代。破棄された敵を指すハンドルは無効になる）
+struct EnemyHandle
+{
+	EnemyType type = EnemyType::Bee;
+	uint32 slot = 0;
+	uint32 generation = 0;  // 0 は無効
+
+	bool isValid() const { return (generation != 0); }
+};
+
+// 敵のスプライト（種類ごとに使うものだけ読み込む）
+enum class EnemySprite : uint8
+{
+	Rest,
+	Flat,    // 踏まれた状態
+	Jump,
+	Fly,
+	FrameA,  // 歩行・飛行・回転アニメーションの1枚目
+	FrameB,  // 同2枚目
+
+	Count
+};
+
 // 敵の基底クラス
 class EnemyBase
 {
@@ -38,14 +65,18 @@ protected:
 	// 基本情報
 	EnemyType m_type;
 	Vec2 m_position;
+	Vec2 m_previousTickPosition;  // 描画補間用：直前のティック開始時の位置
 	Vec2 m_velocity;
 	EnemyState m_state;
 	EnemyDirection m_direction;
 	bool m_isActive;
 	bool m_isAlive;
+	bool m_isSleeping;  // カメラから遠いため更新を止めている
+	EnemyHandle m_handle;  // EnemyPool が生成時に設定する
 
 	// アニメーション関連
-	HashTable<String, Texture> m_textures;
+	static constexpr size_t ENEMY_SPRITE_COUNT = static_cast<size_t>(EnemySprite::Count);
+	std::array<Texture, ENEMY_SPRITE_COUNT> m_sprites;  // 種類ごとの画像の複製。描画時は添字で引く
 	double m_animationTimer;
 	double m_stateTimer;
 
@@ -73,6 +104,15 @@ public:
 	EnemyBase(EnemyType type, const Vec2& startPosition);
 	virtual ~EnemyBase() = default;
 
+	// 種類ごとに保持している画像を手放す（エンジン終了前、TextureCache::Clear() より先に呼ぶ）
+	static void ReleaseSpriteSets();
+
+	// 種類ごとの性質（派生クラスで同名の定数を定義して上書きする）
+	// GameScene は具体的な型のまま if constexpr で分岐するので、実行時の型判定が要らない
+	static constexpr bool TRANSFORMS_AT_NIGHT = false;  // 夜に変身する
+	static constexpr bool STOMPABLE = true;             // 踏んで倒せる
+	static constexpr bool FIREBALL_IMMUNE = false;      // ファイアボールが効かない
+
 	// 純粋仮想関数
 	virtual void init() = 0;
 	virtual void update() = 0;
@@ -95,14 +135,27 @@ public:
 	Vec2 getVelocity() const { return m_velocity; }
 	void setVelocity(const Vec2& velocity) { m_velocity = velocity; }
 
+	// 描画補間（ティック開始時に位置を保存し、描画時に前後のティック間を補間する）
+	void savePreviousTickPosition() { m_previousTickPosition = m_position; }
+	Vec2 getInterpolatedPosition(double alpha) const { return m_previousTickPosition.lerp(m_position, alpha); }
+
 	// 状態取得
 	EnemyType getType() const { return m_type; }
 	EnemyState getState() const { return m_state; }
 	EnemyDirection getDirection() const { return m_direction; }
 	bool isActive() const { return m_isActive; }
+	void setActive(bool active) { m_isActive = active; }
 	bool isAlive() const { return m_isAlive; }
 	bool isGrounded() const { return m_isGrounded; }
 
+	// 自身を指すハンドル（フレームをまたいで敵を参照する場合はポインタではなくこちらを保持する）
+	const EnemyHandle& getHandle() const { return m_handle; }
+	void setHandle(const EnemyHandle& handle) { m_handle = handle; }
+
+	// 休眠（カメラから離れている間は GameScene が更新・衝突判定を止める）
+	bool isSleeping() const { return m_isSleeping; }
+	void setSleeping(bool sleeping) { m_isSleeping = sleeping; }
+
 	// 物理更新
 	virtual void updatePhysics();
 	virtual void applyGravity();
@@ -112,16 +165,15 @@ public:
 	void setGrounded(bool grounded) { m_isGrounded = grounded; }
 	virtual String getStateString() const;
 
-	//種類と見た目のキー
+	//種類のキー
 	virtual String typeKey() const noexcept = 0;
-	virtual String currentVisualKey() const = 0;
 
 	//互換
 	virtual String getTypeString() const { return typeKey(); }
 
 	//互換
 	virtual Texture getCurrentTexture() const {
-		return m_textures.at(currentVisualKey());
+		return getSprite(EnemySprite::Rest);
 	}
 
 	// 特殊能力チェック（新敵用）
@@ -144,7 +196,7 @@ public:
 	void updateBlackFireAnimation() {
 		if (!m_isTransformed) return;
 
-		m_blackFireAnimTimer += Scene::DeltaTime();
+		m_blackFireAnimTimer += SimulationClock::DeltaTime();
 		if (m_blackFireAnimTimer >= BLACKFIRE_FRAME_DURATION) {
 			m_blackFireAnimTimer = 0.0;
 			m_blackFireFrame = (m_blackFireFrame + 1) % 16; // 16フレームループ
@@ -158,6 +210,21 @@ protected:
 	virtual void updateAnimation();
 	virtual void updateCollisionRect();
 
-	virtual String buildTextureKey(const String& action) const;
-	virtual String buildTextureKey(const String& action, const String& variant) const;
+	// Sprites/Enemies/<名前>.png を読み込む（読み込めなかったスロットは Rest で埋める）
+	// 読み込むのは種類ごとに最初の1体だけで、以降の生成では複製するだけなので確保しない
+	void loadSprites(std::initializer_list<std::pair<EnemySprite, StringView>> sprites);
+	const Texture& getSprite(EnemySprite sprite) const { return m_sprites[static_cast<size_t>(sprite)]; }
+
+private:
+	static constexpr size_t ENEMY_TYPE_COUNT = static_cast<size_t>(EnemyType::Fly) + 1;
+
+	// 種類ごとの画像（ステージをまたいで同じ種類が出るので、プロセスの間保持する）
+	struct SpriteSet
+	{
+		std::array<Texture, ENEMY_SPRITE_COUNT> sprites;
+		TextureLease lease;
+		bool isLoaded = false;
+	};
+
+	static std::array<SpriteSet, ENEMY_TYPE_COUNT> s_spriteSets;
 };
@@ -3,12 +3,13 @@
 #include <Siv3D.hpp>
 #include <unordered_map>
 #include <functional>
-#include <memory>
+#include "EnemyBase.hpp"
 //ファクトリーパターンでEnemyKey作成
 
-class EnemyBase;
+class EnemyPool;
 
-using EnemyCreateFn = std::function<std::unique_ptr<EnemyBase>(const Vec2& pos)>;
+// 敵を EnemyPool の中に生成する
+using EnemyCreateFn = std::function<EnemyHandle(EnemyPool& pool, const Vec2& pos)>;
 
 inline std::unordered_map<String, EnemyCreateFn>& enemyRegistry() {
 	static std::unordered_map<String, EnemyCreateFn> reg;
@@ -21,9 +22,9 @@ struct EnemyAutoRegister {
 	}
 };
 
-inline std::unique_ptr<EnemyBase> spawnEnemy(const String& key, const Vec2& pos) {
+inline EnemyHandle spawnEnemy(EnemyPool& pool, const String& key, const Vec2& pos) {
 	if (auto it = enemyRegistry().find(key); it != enemyRegistry().end()) {
-		return it->second(pos);
+		return it->second(pool, pos);
 	}
 	throw std::runtime_error("Unknown enemy key");
 }
@@ -0,0 +1,34 @@
+﻿#include "EnemyPool.hpp"
+
+EnemyPool& EnemyPool::Shared()
+{
+	static EnemyPool pool;
+	return pool;
+}
+
+EnemyBase* EnemyPool::get(const EnemyHandle& handle)
+{
+	EnemyBase* result = nullptr;
+	visit(handle, [&result](EnemyBase& enemy) { result = &enemy; });
+	return result;
+}
+
+bool EnemyPool::destroy(const EnemyHandle& handle)
+{
+	return dispatch(handle, [&handle](auto& pool) { return pool.destroy(handle.slot, handle.generation); });
+}
+
+void EnemyPool::removeInactive()
+{
+	std::apply([](auto&... pools) { (pools.removeInactive(), ...); }, m_pools);
+}
+
+void EnemyPool::clear()
+{
+	std::apply([](auto&... pools) { (pools.clear(), ...); }, m_pools);
+}
+
+size_t EnemyPool::size() const
+{
+	return std::apply([](const auto&... pools) { return (pools.size() + ...); }, m_pools);
+}
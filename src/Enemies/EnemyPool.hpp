@@ -0,0 +1,234 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include <memory>
+#include <tuple>
+#include "EnemyBase.hpp"
+#include "NormalSlime.hpp"
+#include "SpikeSlime.hpp"
+#include "Ladybug.hpp"
+#include "SlimeBlock.hpp"
+#include "Saw.hpp"
+#include "Bee.hpp"
+#include "Fly.hpp"
+
+// 1種類の敵を固定サイズのチャンクに並べて保持するプール
+// 破棄したスロットは世代を進めて再利用し、チャンクは解放しない（ステージのやり直しで再確保しない）
+template <class Enemy>
+class EnemyTypePool
+{
+public:
+	template <class... Args>
+	EnemyHandle spawn(Args&&... args)
+	{
+		uint32 slotIndex;
+		if (!m_freeSlots.isEmpty())
+		{
+			slotIndex = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			slotIndex = m_slotCount++;
+			if (m_chunks.size() * CHUNK_SIZE < m_slotCount)
+			{
+				m_chunks.push_back(std::make_unique<Chunk>());
+			}
+		}
+
+		Slot& slot = getSlot(slotIndex);
+		slot.enemy.emplace(std::forward<Args>(args)...);
+		++m_liveCount;
+
+		const EnemyHandle handle{ slot.enemy->getType(), slotIndex, slot.generation };
+		slot.enemy->setHandle(handle);
+		return handle;
+	}
+
+	// 破棄済みのスロットを指すハンドルには nullptr を返す
+	Enemy* get(uint32 slotIndex, uint32 generation)
+	{
+		if (m_slotCount <= slotIndex) return nullptr;
+
+		Slot& slot = getSlot(slotIndex);
+		if (slot.generation != generation || !slot.enemy) return nullptr;
+
+		return &*slot.enemy;
+	}
+
+	// スロット順に生存中の敵を走査する
+	template <class F>
+	void forEach(F& f)
+	{
+		for (uint32 i = 0; i < m_slotCount; ++i)
+		{
+			if (Slot& slot = getSlot(i); slot.enemy)
+			{
+				f(*slot.enemy);
+			}
+		}
+	}
+
+	template <class F>
+	void forEach(F& f) const
+	{
+		for (uint32 i = 0; i < m_slotCount; ++i)
+		{
+			if (const Slot& slot = getSlot(i); slot.enemy)
+			{
+				f(*slot.enemy);
+			}
+		}
+	}
+
+	// isActive() でなくなった敵を破棄する
+	void removeInactive()
+	{
+		for (uint32 i = 0; i < m_slotCount; ++i)
+		{
+			Slot& slot = getSlot(i);
+			if (slot.enemy && !slot.enemy->isActive())
+			{
+				destroySlot(slot, i);
+			}
+		}
+	}
+
+	// 指定した敵をすぐに破棄する（破棄済みなら false）
+	bool destroy(uint32 slotIndex, uint32 generation)
+	{
+		if (!get(slotIndex, generation)) return false;
+
+		destroySlot(getSlot(slotIndex), slotIndex);
+		return true;
+	}
+
+	// 全て破棄する（チャンクは残し、次の生成は先頭のスロットから詰める）
+	void clear()
+	{
+		for (uint32 i = 0; i < m_slotCount; ++i)
+		{
+			Slot& slot = getSlot(i);
+			if (slot.enemy)
+			{
+				slot.enemy.reset();
+				++slot.generation;
+			}
+		}
+
+		m_freeSlots.clear();
+		m_slotCount = 0;
+		m_liveCount = 0;
+	}
+
+	size_t size() const { return m_liveCount; }
+
+private:
+	static constexpr uint32 CHUNK_SIZE = 32;
+
+	struct Slot
+	{
+		Optional<Enemy> enemy;
+		uint32 generation = 1;
+	};
+
+	using Chunk = std::array<Slot, CHUNK_SIZE>;
+
+	Array<std::unique_ptr<Chunk>> m_chunks;
+	Array<uint32> m_freeSlots;
+	uint32 m_slotCount = 0;  // 使用したことのあるスロット数
+	size_t m_liveCount = 0;
+
+	Slot& getSlot(uint32 slotIndex) { return (*m_chunks[slotIndex / CHUNK_SIZE])[slotIndex % CHUNK_SIZE]; }
+	const Slot& getSlot(uint32 slotIndex) const { return (*m_chunks[slotIndex / CHUNK_SIZE])[slotIndex % CHUNK_SIZE]; }
+
+	void destroySlot(Slot& slot, uint32 slotIndex)
+	{
+		slot.enemy.reset();
+		++slot.generation;
+		m_freeSlots.push_back(slotIndex);
+		--m_liveCount;
+	}
+};
+
+// 全種類の敵のプール
+// 破棄は removeInactive() でまとめて行うので、ティックの途中で得たポインタはそのティックの間は有効
+class EnemyPool
+{
+public:
+	// 同時に存在する GameScene は1つだけなので共有し、シーンを作り直してもメモリを再利用する
+	static EnemyPool& Shared();
+
+	template <class Enemy, class... Args>
+	EnemyHandle spawn(Args&&... args)
+	{
+		return std::get<EnemyTypePool<Enemy>>(m_pools).spawn(std::forward<Args>(args)...);
+	}
+
+	EnemyBase* get(const EnemyHandle& handle);
+
+	// ハンドルの指す敵を具体的な型のまま f に渡す（破棄済みなら呼ばずに false）
+	template <class F>
+	bool visit(const EnemyHandle& handle, F&& f)
+	{
+		return dispatch(handle, [&](auto& pool) {
+			auto* enemy = pool.get(handle.slot, handle.generation);
+			if (!enemy) return false;
+
+			f(*enemy);
+			return true;
+		});
+	}
+
+	// 指定した敵をすぐに破棄する（ティックの途中では使わない。破棄済みなら false）
+	bool destroy(const EnemyHandle& handle);
+
+	// 種類ごとにまとめて走査する（種類の順 → 各種類の中ではスロット順）
+	// f を汎用ラムダにすると種類ごとに具体的な型で展開され、仮想関数呼び出しやダウンキャストなしで更新できる
+	template <class F>
+	void forEach(F&& f)
+	{
+		std::apply([&f](auto&... pools) { (pools.forEach(f), ...); }, m_pools);
+	}
+
+	template <class F>
+	void forEach(F&& f) const
+	{
+		std::apply([&f](const auto&... pools) { (pools.forEach(f), ...); }, m_pools);
+	}
+
+	// ティックの最後に呼び、isActive() でなくなった敵を破棄する
+	void removeInactive();
+	void clear();
+
+	size_t size() const;
+	bool isEmpty() const { return (size() == 0); }
+
+private:
+	std::tuple<
+		EnemyTypePool<Bee>,
+		EnemyTypePool<NormalSlime>,
+		EnemyTypePool<Saw>,
+		EnemyTypePool<Ladybug>,
+		EnemyTypePool<SlimeBlock>,
+		EnemyTypePool<SpikeSlime>,
+		EnemyTypePool<Fly>> m_pools;
+
+	// ハンドルの種類のプールを f に渡す
+	template <class F>
+	bool dispatch(const EnemyHandle& handle, F&& f)
+	{
+		if (!handle.isValid()) return false;
+
+		switch (handle.type)
+		{
+		case EnemyType::Bee:         return f(std::get<EnemyTypePool<Bee>>(m_pools));
+		case EnemyType::NormalSlime: return f(std::get<EnemyTypePool<NormalSlime>>(m_pools));
+		case EnemyType::Saw:         return f(std::get<EnemyTypePool<Saw>>(m_pools));
+		case EnemyType::Ladybug:     return f(std::get<EnemyTypePool<Ladybug>>(m_pools));
+		case EnemyType::SlimeBlock:  return f(std::get<EnemyTypePool<SlimeBlock>>(m_pools));
+		case EnemyType::SpikeSlime:  return f(std::get<EnemyTypePool<SpikeSlime>>(m_pools));
+		case EnemyType::Fly:         return f(std::get<EnemyTypePool<Fly>>(m_pools));
+		default:                     return false;
+		}
+	}
+};
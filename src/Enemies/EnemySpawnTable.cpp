@@ -0,0 +1,63 @@
+﻿#include "EnemySpawnTable.hpp"
+
+std::array<Optional<Array<EnemySpawn>>, EnemySpawnTable::STAGE_COUNT> EnemySpawnTable::s_tables;
+
+const Array<EnemySpawn>& EnemySpawnTable::Get(StageNumber stageNumber)
+{
+	static const Array<EnemySpawn> empty;
+
+	const size_t index = static_cast<size_t>(stageNumber);
+	if (STAGE_COUNT <= index) return empty;
+
+	auto& table = s_tables[index];
+	if (!table)
+	{
+		table = Load(stageNumber);
+	}
+	return *table;
+}
+
+std::pair<size_t, size_t> EnemySpawnTable::FindRange(const Array<EnemySpawn>& spawns, double minX, double maxX)
+{
+	const auto first = std::lower_bound(spawns.begin(), spawns.end(), minX,
+		[](const EnemySpawn& spawn, double x) { return spawn.position.x < x; });
+	const auto last = std::upper_bound(first, spawns.end(), maxX,
+		[](double x, const EnemySpawn& spawn) { return x < spawn.position.x; });
+
+	return { static_cast<size_t>(first - spawns.begin()), static_cast<size_t>(last - spawns.begin()) };
+}
+
+Array<EnemySpawn> EnemySpawnTable::Load(StageNumber stageNumber)
+{
+	Array<EnemySpawn> spawns;
+
+	const String stageFile = U"Stages/Stage{}.json"_fmt(static_cast<int>(stageNumber));
+
+	if (!FileSystem::Exists(stageFile)) {
+#ifdef _DEBUG
+		Print << U"Not find Stage file: " << stageFile;
+#endif
+		return spawns;
+	}
+
+	const JSON stageData = JSON::Load(stageFile);
+	if (!stageData) {
+#ifdef _DEBUG
+		Print << U"Failed to load json: " << stageFile;
+#endif
+		return spawns;
+	}
+
+	for (const auto& enemyEntry : stageData.arrayView()) {
+		const String type = enemyEntry[U"type"].getString();
+		const double x = enemyEntry[U"x"].get<double>();
+		const double y = enemyEntry[U"y"].get<double>();
+		spawns.push_back(EnemySpawn{ type, Vec2{ x, y } });
+	}
+
+	// 同じ x の敵はファイルの順を保つ（生成順を毎回同じにするため）
+	std::stable_sort(spawns.begin(), spawns.end(),
+		[](const EnemySpawn& a, const EnemySpawn& b) { return a.position.x < b.position.x; });
+
+	return spawns;
+}
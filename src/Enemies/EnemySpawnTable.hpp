@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+enum class StageNumber;
+
+// ステージJSONに書かれた敵1体の出現情報
+struct EnemySpawn
+{
+	String type;
+	Vec2 position;
+};
+
+// ステージごとの敵の出現リスト（出現位置の x の昇順）
+// JSON はステージごとに最初の1回だけ読み、ステージの読み直しやリトライではキャッシュを返す
+class EnemySpawnTable
+{
+public:
+	static const Array<EnemySpawn>& Get(StageNumber stageNumber);
+
+	// 出現位置の x が [minX, maxX] に入る範囲の添字 [first, last)
+	static std::pair<size_t, size_t> FindRange(const Array<EnemySpawn>& spawns, double minX, double maxX);
+
+private:
+	static constexpr size_t STAGE_COUNT = 7;  // Tutorial + Stage1～6
+
+	static std::array<Optional<Array<EnemySpawn>>, STAGE_COUNT> s_tables;
+
+	static Array<EnemySpawn> Load(StageNumber stageNumber);
+};
@@ -1,5 +1,6 @@
 ﻿#include "Fly.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 Fly::Fly(const Vec2& startPosition)
 	: EnemyBase(EnemyType::Fly, startPosition)  // Use correct Fly type
@@ -57,7 +58,7 @@ void Fly::update()
 	// Flyは重力の影響を受けないので、独自の物理更新
 	if (m_isFlying)
 	{
-		const double deltaTime = Scene::DeltaTime();
+		const double deltaTime = SimulationClock::DeltaTime();
 		m_position += m_velocity * deltaTime;
 		updateCollisionRect();
 	}
@@ -124,29 +125,13 @@ void Fly::draw() const
 
 void Fly::loadTextures()
 {
-	m_textures.clear();
+	const ScopedTrace trace{ U"Fly::loadTextures" };
 
-	const String basePath = U"Sprites/Enemies/";
-	Array<String> textureNames = {
-		U"fly_rest",
-		U"fly_a",
-		U"fly_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	loadSprites({
+		{ EnemySprite::Rest, U"fly_rest" },
+		{ EnemySprite::FrameA, U"fly_a" },
+		{ EnemySprite::FrameB, U"fly_b" }
+	});
 }
 
 void Fly::setState(EnemyState newState)
@@ -211,7 +196,7 @@ void Fly::updateMovement()
 {
 	if (!m_isFlying) return;
 
-	m_directionTimer += Scene::DeltaTime();
+	m_directionTimer += SimulationClock::DeltaTime();
 	if (m_directionTimer >= DIRECTION_CHANGE_TIME)
 	{
 		changeDirection();
@@ -225,7 +210,7 @@ void Fly::updateMovement()
 	}
 
 	// 不規則な動きを基本移動に追加
-	m_velocity += m_erraticOffset * Scene::DeltaTime() * 100.0;
+	m_velocity += m_erraticOffset * SimulationClock::DeltaTime() * 100.0;
 }
 
 void Fly::changeDirection()
@@ -243,7 +228,7 @@ void Fly::updateErraticMovement()
 {
 	if (!m_isFlying) return;
 
-	m_erraticTimer += Scene::DeltaTime();
+	m_erraticTimer += SimulationClock::DeltaTime();
 
 	// 不規則な動きを計算
 	const double erraticX = std::sin(m_erraticTimer * ERRATIC_SPEED) * ERRATIC_AMPLITUDE;
@@ -259,7 +244,7 @@ void Fly::updateFlyBehavior()
 
 void Fly::updateFlattenedBehavior()
 {
-	m_flattenedTimer += Scene::DeltaTime();
+	m_flattenedTimer += SimulationClock::DeltaTime();
 
 	if (m_flattenedTimer >= FLATTENED_DURATION)
 	{
@@ -279,47 +264,12 @@ void Fly::updateHitBehavior()
 
 Texture Fly::getCurrentTexture() const
 {
-	String textureKey;
-
-	switch (m_state)
-	{
-	case EnemyState::Idle:
-		textureKey = U"fly_rest";
-		break;
-	case EnemyState::Walk:
-		if (m_isFlying)
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, FLY_ANIMATION_SPEED * 2) < FLY_ANIMATION_SPEED;
-			textureKey = useVariantA ? U"fly_a" : U"fly_b";
-		}
-		else
-		{
-			textureKey = U"fly_rest";
-		}
-		break;
-	case EnemyState::Flattened:
-		textureKey = U"fly_rest";
-		break;
-	case EnemyState::Hit:
-		textureKey = U"fly_rest";
-		break;
-	case EnemyState::Dead:
-		textureKey = U"fly_rest";
-		break;
-	default:
-		textureKey = U"fly_rest";
-		break;
-	}
-
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
-	}
-	else if (m_textures.contains(U"fly_rest"))
+	if (m_state == EnemyState::Walk && m_isFlying)
 	{
-		return m_textures.at(U"fly_rest");
+		const bool useVariantA = std::fmod(m_animationTimer, FLY_ANIMATION_SPEED * 2) < FLY_ANIMATION_SPEED;
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	return Texture{};
+	return getSprite(EnemySprite::Rest);
 }
 
 void Fly::drawFlyTrail() const
@@ -388,36 +338,9 @@ void Fly::drawHitEffect() const
 	}
 }
 
-String Fly::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Idle:
-		return U"fly_rest";
-	case EnemyState::Walk:
-		if (m_isFlying)
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, FLY_ANIMATION_SPEED * 2) < FLY_ANIMATION_SPEED;
-			return useVariantA ? U"fly_a" : U"fly_b";
-		}
-		else
-		{
-			return U"fly_rest";
-		}
-	case EnemyState::Flattened:
-		return U"fly_rest";
-	case EnemyState::Hit:
-		return U"fly_rest";
-	case EnemyState::Dead:
-		return U"fly_rest";
-	default:
-		return U"fly_rest";
-	}
-}
-
 static EnemyAutoRegister _regFly{
 	U"Fly",
-	[](const Vec2& pos) {
-		return std::make_unique<Fly>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<Fly>(pos);
     }
 };
@@ -27,12 +27,14 @@ private:
 	bool m_isFlying;
 
 public:
+	// 種類ごとの性質（EnemyBase の定数を上書き）
+	static constexpr bool TRANSFORMS_AT_NIGHT = true;
+
 	Fly(const Vec2& startPosition);
 	~Fly() override = default;
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"Fly"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
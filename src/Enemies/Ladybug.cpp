@@ -1,5 +1,6 @@
 ﻿#include "Ladybug.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 Ladybug::Ladybug(const Vec2& startPosition)
 	: EnemyBase(EnemyType::Ladybug, startPosition)
@@ -111,30 +112,14 @@ void Ladybug::draw() const
 
 void Ladybug::loadTextures()
 {
-	m_textures.clear();
-
-	const String basePath = U"Sprites/Enemies/";
-	Array<String> textureNames = {
-		U"ladybug_rest",
-		U"ladybug_fly",
-		U"ladybug_walk_a",
-		U"ladybug_walk_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	const ScopedTrace trace{ U"Ladybug::loadTextures" };
+
+	loadSprites({
+		{ EnemySprite::Rest, U"ladybug_rest" },
+		{ EnemySprite::Fly, U"ladybug_fly" },
+		{ EnemySprite::FrameA, U"ladybug_walk_a" },
+		{ EnemySprite::FrameB, U"ladybug_walk_b" }
+	});
 }
 
 void Ladybug::setState(EnemyState newState)
@@ -215,7 +200,7 @@ void Ladybug::startFlying()
 
 void Ladybug::updateMovement()
 {
-	m_modeTimer += Scene::DeltaTime();
+	m_modeTimer += SimulationClock::DeltaTime();
 
 	// モード切り替え
 	if (m_isFlyMode && m_modeTimer >= FLY_MODE_DURATION)
@@ -294,7 +279,7 @@ void Ladybug::updateFlyBehavior()
 	if (distance > 10.0)
 	{
 		const Vec2 normalizedDirection = direction.normalized();
-		m_velocity = normalizedDirection * m_moveSpeed * Scene::DeltaTime() * 60.0;
+		m_velocity = normalizedDirection * m_moveSpeed * SimulationClock::DeltaTime() * 60.0;
 	}
 	else
 	{
@@ -305,7 +290,7 @@ void Ladybug::updateFlyBehavior()
 
 void Ladybug::updateFlattenedBehavior()
 {
-	m_flattenedTimer += Scene::DeltaTime();
+	m_flattenedTimer += SimulationClock::DeltaTime();
 
 	if (m_flattenedTimer >= FLATTENED_DURATION)
 	{
@@ -325,47 +310,17 @@ void Ladybug::updateHitBehavior()
 
 Texture Ladybug::getCurrentTexture() const
 {
-	String textureKey;
-
-	switch (m_state)
+	if (m_state == EnemyState::Walk)
 	{
-	case EnemyState::Idle:
-		textureKey = U"ladybug_rest";
-		break;
-	case EnemyState::Walk:
 		if (m_isFlyMode)
 		{
-			textureKey = U"ladybug_fly";
-		}
-		else
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-			textureKey = useVariantA ? U"ladybug_walk_a" : U"ladybug_walk_b";
+			return getSprite(EnemySprite::Fly);
 		}
-		break;
-	case EnemyState::Flattened:
-		textureKey = U"ladybug_rest";
-		break;
-	case EnemyState::Hit:
-		textureKey = U"ladybug_rest";
-		break;
-	case EnemyState::Dead:
-		textureKey = U"ladybug_rest";
-		break;
-	default:
-		textureKey = U"ladybug_rest";
-		break;
-	}
 
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
-	}
-	else if (m_textures.contains(U"ladybug_rest"))
-	{
-		return m_textures.at(U"ladybug_rest");
+		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	return Texture{};
+	return getSprite(EnemySprite::Rest);
 }
 
 void Ladybug::drawFlyTrail() const
@@ -420,34 +375,9 @@ void Ladybug::drawHitEffect() const
 	}
 }
 
-String Ladybug::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Walk:
-		if (m_isFlyMode)
-		{
-			return U"ladybug_fly";
-		}
-		else
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-			return useVariantA ? U"ladybug_walk_a" : U"ladybug_walk_b";
-		}
-		return U"ladybug_rest";
-	case EnemyState::Flattened:
-	case EnemyState::Hit:
-	case EnemyState::Dead:
-	case EnemyState::Idle:
-		return U"ladybug_rest";
-	default:
-		return U"ladybug_rest";
-	}
-}
-
 static EnemyAutoRegister _regLadybug{
 	U"Ladybug",
-	[](const Vec2& pos) {
-		return std::make_unique<Ladybug>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<Ladybug>(pos);
     }
 };
@@ -33,7 +33,6 @@ public:
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"Ladybug"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
@@ -1,5 +1,6 @@
 ﻿#include "NormalSlime.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 NormalSlime::NormalSlime(const Vec2& startPosition)
 	: EnemyBase(EnemyType::NormalSlime, startPosition)
@@ -103,32 +104,14 @@ void NormalSlime::draw() const
 }
 void NormalSlime::loadTextures()
 {
-	m_textures.clear();
-
-	const String basePath = U"Sprites/Enemies/";
-
-	// スライムのテクスチャを読み込み
-	Array<String> textureNames = {
-		U"slime_normal_rest",
-		U"slime_normal_flat",
-		U"slime_normal_walk_a",
-		U"slime_normal_walk_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	const ScopedTrace trace{ U"NormalSlime::loadTextures" };
+
+	loadSprites({
+		{ EnemySprite::Rest, U"slime_normal_rest" },
+		{ EnemySprite::Flat, U"slime_normal_flat" },
+		{ EnemySprite::FrameA, U"slime_normal_walk_a" },
+		{ EnemySprite::FrameB, U"slime_normal_walk_b" }
+	});
 }
 
 void NormalSlime::setState(EnemyState newState)
@@ -206,7 +189,7 @@ void NormalSlime::updateMovement()
 	if (m_state == EnemyState::Walk)
 	{
 		// 一定時間で方向転換
-		m_directionTimer += Scene::DeltaTime();
+		m_directionTimer += SimulationClock::DeltaTime();
 		if (m_directionTimer >= DIRECTION_CHANGE_TIME)
 		{
 			changeDirection();
@@ -229,7 +212,7 @@ void NormalSlime::updateWalkBehavior()
 
 void NormalSlime::updateFlattenedBehavior()
 {
-	m_flattenedTimer += Scene::DeltaTime();
+	m_flattenedTimer += SimulationClock::DeltaTime();
 
 	// 一定時間後に死亡状態に変更（アニメーション表示後）
 	if (m_flattenedTimer >= FLATTENED_DURATION)
@@ -265,46 +248,20 @@ void NormalSlime::changeDirection()
 
 Texture NormalSlime::getCurrentTexture() const
 {
-	String textureKey;
-
 	switch (m_state)
 	{
-	case EnemyState::Idle:
-		textureKey = U"slime_normal_rest";
-		break;
 	case EnemyState::Walk:
 	{
 		// ウォークアニメーション（walk_a と walk_b を交互に）
 		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-		textureKey = useVariantA ? U"slime_normal_walk_a" : U"slime_normal_walk_b";
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	break;
 	case EnemyState::Flattened:
-		textureKey = U"slime_normal_flat";
-		break;
-	case EnemyState::Hit:
-		textureKey = U"slime_normal_rest";  // ヒット時は静止画像
-		break;
 	case EnemyState::Dead:
-		textureKey = U"slime_normal_flat";  // 死亡時は平たい状態
-		break;
+		return getSprite(EnemySprite::Flat);  // 踏まれた・死亡時は平たい状態
+	case EnemyState::Hit:
 	default:
-		textureKey = U"slime_normal_rest";
-		break;
-	}
-
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
-	}
-	else
-	{
-		// フォールバック
-		if (m_textures.contains(U"slime_normal_rest"))
-		{
-			return m_textures.at(U"slime_normal_rest");
-		}
-		return Texture{};
+		return getSprite(EnemySprite::Rest);  // ヒット時は静止画像
 	}
 }
 
@@ -347,38 +304,10 @@ void NormalSlime::drawHitEffect() const
 	}
 }
 
-String NormalSlime::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Idle:
-		return U"slime_normal_rest";
-		break;
-	case EnemyState::Walk:
-	{
-		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-		return useVariantA ? U"slime_normal_walk_a" : U"slime_normal_walk_b";
-	}
-	break;
-	case EnemyState::Flattened:
-		return U"slime_normal_flat";
-		break;
-	case EnemyState::Hit:
-		return U"slime_normal_rest"; 
-		break;
-	case EnemyState::Dead:
-		return  U"slime_normal_flat"; 
-		break;
-	default:
-		return U"slime_normal_rest";
-		break;
-	}
-}
-
 static EnemyAutoRegister _regNormalSlime{
 	U"NormalSlime",
-	[](const Vec2& pos) {
-		return std::make_unique<NormalSlime>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<NormalSlime>(pos);
 	}
 };
 
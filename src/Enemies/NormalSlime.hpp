@@ -22,12 +22,14 @@ private:
 	double m_flattenedTimer;
 
 public:
+	// 種類ごとの性質（EnemyBase の定数を上書き）
+	static constexpr bool TRANSFORMS_AT_NIGHT = true;
+
 	NormalSlime(const Vec2& startPosition);
 	~NormalSlime() override = default;
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"NormalSlime"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
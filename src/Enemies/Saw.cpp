@@ -1,5 +1,6 @@
 ﻿#include "Saw.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 Saw::Saw(const Vec2& startPosition)
 	: EnemyBase(EnemyType::Saw, startPosition)
@@ -84,29 +85,13 @@ void Saw::draw() const
 
 void Saw::loadTextures()
 {
-	m_textures.clear();
+	const ScopedTrace trace{ U"Saw::loadTextures" };
 
-	const String basePath = U"Sprites/Enemies/";
-	Array<String> textureNames = {
-		U"saw_rest",
-		U"saw_a",
-		U"saw_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	loadSprites({
+		{ EnemySprite::Rest, U"saw_rest" },
+		{ EnemySprite::FrameA, U"saw_a" },
+		{ EnemySprite::FrameB, U"saw_b" }
+	});
 }
 
 void Saw::setState(EnemyState newState)
@@ -160,7 +145,7 @@ void Saw::updateMovement()
 {
 	if (m_state == EnemyState::Walk)
 	{
-		m_directionTimer += Scene::DeltaTime();
+		m_directionTimer += SimulationClock::DeltaTime();
 		if (m_directionTimer >= DIRECTION_CHANGE_TIME)
 		{
 			changeDirection();
@@ -190,7 +175,7 @@ void Saw::updateRotation()
 {
 	if (m_isSpinning)
 	{
-		m_rotationAngle += ROTATE_SPEED * Scene::DeltaTime();
+		m_rotationAngle += ROTATE_SPEED * SimulationClock::DeltaTime();
 		if (m_rotationAngle >= Math::TwoPi)
 		{
 			m_rotationAngle -= Math::TwoPi;
@@ -200,32 +185,17 @@ void Saw::updateRotation()
 
 void Saw::updateSparks()
 {
-	m_sparkTimer += Scene::DeltaTime();
+	m_sparkTimer += SimulationClock::DeltaTime();
 }
 
 Texture Saw::getCurrentTexture() const
 {
-	String textureKey;
-
 	if (m_isSpinning)
 	{
 		const bool useVariantA = std::fmod(m_animationTimer, SAW_ANIMATION_SPEED * 2) < SAW_ANIMATION_SPEED;
-		textureKey = useVariantA ? U"saw_a" : U"saw_b";
-	}
-	else
-	{
-		textureKey = U"saw_rest";
-	}
-
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	else if (m_textures.contains(U"saw_rest"))
-	{
-		return m_textures.at(U"saw_rest");
-	}
-	return Texture{};
+	return getSprite(EnemySprite::Rest);
 }
 
 void Saw::drawDangerEffect() const
@@ -278,34 +248,9 @@ void Saw::drawRotationEffect() const
 	}
 }
 
-String Saw::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Walk:
-		if (m_isSpinning)
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, SAW_ANIMATION_SPEED * 2) < SAW_ANIMATION_SPEED;
-			return useVariantA ? U"saw_a" : U"saw_b";
-		}
-		else
-		{
-			return U"saw_rest";
-		}
-		return U"saw_rest";
-	case EnemyState::Flattened:
-	case EnemyState::Hit:
-	case EnemyState::Dead:
-	case EnemyState::Idle:
-		return U"saw_rest";
-	default:
-		return U"saw_rest";
-	}
-}
-
 static EnemyAutoRegister _regSaw{
 	U"Saw",
-	[](const Vec2& pos) {
-		return std::make_unique<Saw>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<Saw>(pos);
 	}
 };
@@ -23,12 +23,15 @@ private:
 	double m_sparkTimer;
 
 public:
+	// 種類ごとの性質（EnemyBase の定数を上書き）
+	static constexpr bool STOMPABLE = false;
+	static constexpr bool FIREBALL_IMMUNE = true;
+
 	Saw(const Vec2& startPosition);
 	~Saw() override = default;
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"Saw"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
@@ -1,5 +1,6 @@
 ﻿#include "SlimeBlock.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 SlimeBlock::SlimeBlock(const Vec2& startPosition)
 	: EnemyBase(EnemyType::SlimeBlock, startPosition)
@@ -102,30 +103,14 @@ void SlimeBlock::draw() const
 
 void SlimeBlock::loadTextures()
 {
-	m_textures.clear();
-
-	const String basePath = U"Sprites/Enemies/";
-	Array<String> textureNames = {
-		U"slime_block_rest",
-		U"slime_block_jump",
-		U"slime_block_walk_a",
-		U"slime_block_walk_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	const ScopedTrace trace{ U"SlimeBlock::loadTextures" };
+
+	loadSprites({
+		{ EnemySprite::Rest, U"slime_block_rest" },
+		{ EnemySprite::Jump, U"slime_block_jump" },
+		{ EnemySprite::FrameA, U"slime_block_walk_a" },
+		{ EnemySprite::FrameB, U"slime_block_walk_b" }
+	});
 }
 
 void SlimeBlock::setState(EnemyState newState)
@@ -202,7 +187,7 @@ void SlimeBlock::updateMovement()
 	if (m_state == EnemyState::Walk)
 	{
 		// ジャンプタイマー更新
-		m_jumpTimer += Scene::DeltaTime();
+		m_jumpTimer += SimulationClock::DeltaTime();
 		if (m_jumpTimer >= JUMP_INTERVAL && !m_isJumping)
 		{
 			m_canJump = true;
@@ -210,7 +195,7 @@ void SlimeBlock::updateMovement()
 		}
 
 		// 方向転換タイマー
-		m_directionTimer += Scene::DeltaTime();
+		m_directionTimer += SimulationClock::DeltaTime();
 		if (m_directionTimer >= DIRECTION_CHANGE_TIME)
 		{
 			changeDirection();
@@ -244,7 +229,7 @@ void SlimeBlock::updateWalkBehavior()
 
 void SlimeBlock::updateFlattenedBehavior()
 {
-	m_flattenedTimer += Scene::DeltaTime();
+	m_flattenedTimer += SimulationClock::DeltaTime();
 
 	if (m_flattenedTimer >= FLATTENED_DURATION)
 	{
@@ -275,47 +260,17 @@ void SlimeBlock::updateJumpState()
 
 Texture SlimeBlock::getCurrentTexture() const
 {
-	String textureKey;
-
-	switch (m_state)
+	if (m_state == EnemyState::Walk)
 	{
-	case EnemyState::Idle:
-		textureKey = U"slime_block_rest";
-		break;
-	case EnemyState::Walk:
 		if (m_isJumping)
 		{
-			textureKey = U"slime_block_jump";
-		}
-		else
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-			textureKey = useVariantA ? U"slime_block_walk_a" : U"slime_block_walk_b";
+			return getSprite(EnemySprite::Jump);
 		}
-		break;
-	case EnemyState::Flattened:
-		textureKey = U"slime_block_rest";
-		break;
-	case EnemyState::Hit:
-		textureKey = U"slime_block_rest";
-		break;
-	case EnemyState::Dead:
-		textureKey = U"slime_block_rest";
-		break;
-	default:
-		textureKey = U"slime_block_rest";
-		break;
-	}
 
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
-	}
-	else if (m_textures.contains(U"slime_block_rest"))
-	{
-		return m_textures.at(U"slime_block_rest");
+		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	return Texture{};
+	return getSprite(EnemySprite::Rest);
 }
 
 void SlimeBlock::drawJumpPreparation() const
@@ -372,37 +327,9 @@ void SlimeBlock::drawHitEffect() const
 	}
 }
 
-String SlimeBlock::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Idle:
-		return U"slime_block_rest";
-	case EnemyState::Walk:
-		if (m_isJumping)
-		{
-			return U"slime_block_jump";
-		}
-		else
-		{
-			const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-			return useVariantA ? U"slime_block_walk_a" : U"slime_block_walk_b";
-		}
-		return U"slime_block_rest";
-	case EnemyState::Flattened:
-		return U"slime_block_rest";
-	case EnemyState::Hit:
-		return U"slime_block_rest";
-	case EnemyState::Dead:
-		return U"slime_block_rest";
-	default:
-		return U"slime_block_rest";
-	}
-}
-
 static EnemyAutoRegister _regSlimeBlock{
 	U"SlimeBlock",
-	[](const Vec2& pos) {
-		return std::make_unique<SlimeBlock>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<SlimeBlock>(pos);
 	}
 };
@@ -32,7 +32,6 @@ public:
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"SlimeBlock"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
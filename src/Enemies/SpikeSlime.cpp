@@ -1,5 +1,6 @@
 ﻿#include "SpikeSlime.hpp"
 #include "EnemyFactory.hpp"
+#include "EnemyPool.hpp"
 
 SpikeSlime::SpikeSlime(const Vec2& startPosition)
 	: EnemyBase(EnemyType::SpikeSlime, startPosition)
@@ -92,30 +93,14 @@ void SpikeSlime::draw() const
 
 void SpikeSlime::loadTextures()
 {
-	m_textures.clear();
-
-	const String basePath = U"Sprites/Enemies/";
-	Array<String> textureNames = {
-		U"slime_spike_rest",
-		U"slime_spike_flat",
-		U"slime_spike_walk_a",
-		U"slime_spike_walk_b"
-	};
-
-	for (const auto& textureName : textureNames)
-	{
-		const String filepath = basePath + textureName + U".png";
-		Texture texture(filepath);
-
-		if (texture)
-		{
-			m_textures[textureName] = texture;
-		}
-		else
-		{
-			Print << U"Failed to load texture: " << filepath;
-		}
-	}
+	const ScopedTrace trace{ U"SpikeSlime::loadTextures" };
+
+	loadSprites({
+		{ EnemySprite::Rest, U"slime_spike_rest" },
+		{ EnemySprite::Flat, U"slime_spike_flat" },
+		{ EnemySprite::FrameA, U"slime_spike_walk_a" },
+		{ EnemySprite::FrameB, U"slime_spike_walk_b" }
+	});
 }
 
 void SpikeSlime::setState(EnemyState newState)
@@ -173,7 +158,7 @@ void SpikeSlime::updateMovement()
 {
 	if (m_state == EnemyState::Walk)
 	{
-		m_directionTimer += Scene::DeltaTime();
+		m_directionTimer += SimulationClock::DeltaTime();
 		if (m_directionTimer >= DIRECTION_CHANGE_TIME)
 		{
 			changeDirection();
@@ -214,39 +199,18 @@ void SpikeSlime::updateHitBehavior()
 
 Texture SpikeSlime::getCurrentTexture() const
 {
-	String textureKey;
-
 	switch (m_state)
 	{
-	case EnemyState::Idle:
-		textureKey = U"slime_spike_rest";
-		break;
 	case EnemyState::Walk:
 	{
 		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-		textureKey = useVariantA ? U"slime_spike_walk_a" : U"slime_spike_walk_b";
+		return getSprite(useVariantA ? EnemySprite::FrameA : EnemySprite::FrameB);
 	}
-	break;
-	case EnemyState::Hit:
-		textureKey = U"slime_spike_rest";
-		break;
 	case EnemyState::Dead:
-		textureKey = U"slime_spike_flat";
-		break;
+		return getSprite(EnemySprite::Flat);
 	default:
-		textureKey = U"slime_spike_rest";
-		break;
-	}
-
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
+		return getSprite(EnemySprite::Rest);
 	}
-	else if (m_textures.contains(U"slime_spike_rest"))
-	{
-		return m_textures.at(U"slime_spike_rest");
-	}
-	return Texture{};
 }
 
 void SpikeSlime::drawSpikeWarning() const
@@ -290,34 +254,9 @@ void SpikeSlime::drawHitEffect() const
 	}
 }
 
-String SpikeSlime::currentVisualKey() const
-{
-	switch (m_state)
-	{
-	case EnemyState::Idle:
-		return U"slime_spike_rest";
-		break;
-	case EnemyState::Walk:
-	{
-		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-		return useVariantA ? U"slime_spike_walk_a" : U"slime_spike_walk_b";
-	}
-	break;
-	case EnemyState::Hit:
-		return U"slime_spike_rest";
-		break;
-	case EnemyState::Dead:
-		return U"slime_spike_flat";
-		break;
-	default:
-		return U"slime_spike_rest";
-		break;
-	}
-}
-
 static EnemyAutoRegister _regSpikeSlime{
 	U"SpikeSlime",
-	[](const Vec2& pos) {
-		return std::make_unique<SpikeSlime>(pos);
+	[](EnemyPool& pool, const Vec2& pos) {
+		return pool.spawn<SpikeSlime>(pos);
 	}
 };
@@ -24,12 +24,15 @@ private:
 	// スパイクは常に危険（削除: bool m_isSpikeDangerous）
 
 public:
+	// 種類ごとの性質（EnemyBase の定数を上書き）
+	static constexpr bool TRANSFORMS_AT_NIGHT = true;
+	static constexpr bool STOMPABLE = false;  // 常にスパイクがある
+
 	SpikeSlime(const Vec2& startPosition);
 	~SpikeSlime() override = default;
 
 	//ファクトリーパターンのEnemyKey
 	String typeKey() const noexcept override { return U"SpikeSlime"; }
-	String currentVisualKey() const override;
 
 	// EnemyBaseの純粋仮想関数の実装
 	void init() override;
@@ -1,8 +1,23 @@
 ﻿#include <Siv3D.hpp>
 #include "Core/Game.hpp"
 
+#ifdef ALIENS_DAYS_HEADLESS
+#include "App/HeadlessRunner.hpp"
+
+// ウィンドウ・GPUなしで起動する（ビルドサーバーでのベンチマーク用）
+SIV3D_SET(EngineOption::Renderer::Headless)
+#endif
+
 void Main()
 {
+#ifdef ALIENS_DAYS_HEADLESS
+	HeadlessRunner runner;
+	if (!runner.run(HeadlessRunner::ParseCommandLine(System::GetCommandLineArgs())))
+	{
+		// CI で検出できるよう終了コードで失敗を返す
+		std::exit(EXIT_FAILURE);
+	}
+#else
 	Profiler::EnableAssetCreationWarning(false);
 	FontAsset::Register(U"Menu", 20, Typeface::Bold);
 	// ゲームインスタンスの作成
@@ -20,4 +35,5 @@ void Main()
 
 	// ゲームの終了処理
 	game.shutdown();
+#endif
 }
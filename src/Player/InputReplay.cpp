@@ -0,0 +1,191 @@
+﻿#include "InputReplay.hpp"
+#include "../Stages/Stage.hpp"
+
+namespace
+{
+	enum InputBit : uint8
+	{
+		Left = 1 << 0,
+		Right = 1 << 1,
+		Up = 1 << 2,
+		Down = 1 << 3,
+		JumpPressed = 1 << 4,
+		JumpDown = 1 << 5,
+		FireDown = 1 << 6,
+	};
+}
+
+InputReplay::InputReplay()
+	: m_playbackRun(0)
+	, m_playbackOffset(0)
+	, m_playbackTick(0)
+{
+	m_header.stage = StageNumber::Stage1;
+}
+
+void InputReplay::beginRecording(StageNumber stage, PlayerColor color, uint64 seed)
+{
+	clear();
+	m_runs.reserve(RESERVED_RUNS);
+	m_header.stage = stage;
+	m_header.color = color;
+	m_header.seed = seed;
+}
+
+void InputReplay::record(const PlayerInput& input)
+{
+	const uint8 bits = Pack(input);
+
+	// 直前と同じ入力なら区間を伸ばす
+	if (!m_runs.isEmpty() && m_runs.back().bits == bits && m_runs.back().count < UINT16_MAX)
+	{
+		++m_runs.back().count;
+	}
+	else
+	{
+		m_runs << Run{ bits, 1 };
+	}
+	++m_header.tickCount;
+}
+
+void InputReplay::clear()
+{
+	m_runs.clear();
+	m_header.tickCount = 0;
+	m_header.finalPlayerPosition = Vec2::Zero();
+	rewind();
+}
+
+bool InputReplay::save(FilePathView path) const
+{
+	FileSystem::CreateParentDirectories(path);
+
+	BinaryWriter writer{ path };
+	if (!writer)
+	{
+		return false;
+	}
+
+	writer.write(FILE_MAGIC);
+	writer.write(FILE_VERSION);
+	writer.write(static_cast<int32>(m_header.stage));
+	writer.write(static_cast<int32>(m_header.color));
+	writer.write(m_header.seed);
+	writer.write(m_header.tickCount);
+	writer.write(m_header.finalPlayerPosition.x);
+	writer.write(m_header.finalPlayerPosition.y);
+	writer.write(static_cast<uint32>(m_runs.size()));
+
+	for (const auto& run : m_runs)
+	{
+		writer.write(run.bits);
+		writer.write(run.count);
+	}
+	return true;
+}
+
+bool InputReplay::load(FilePathView path)
+{
+	BinaryReader reader{ path };
+	if (!reader)
+	{
+		return false;
+	}
+
+	uint32 magic = 0, version = 0;
+	if (!reader.read(magic) || !reader.read(version) || magic != FILE_MAGIC || version != FILE_VERSION)
+	{
+		return false;
+	}
+
+	int32 stage = 0, color = 0;
+	uint32 runCount = 0;
+	Header header;
+	if (!reader.read(stage) || !reader.read(color) ||
+		!reader.read(header.seed) || !reader.read(header.tickCount) ||
+		!reader.read(header.finalPlayerPosition.x) || !reader.read(header.finalPlayerPosition.y) ||
+		!reader.read(runCount))
+	{
+		return false;
+	}
+	header.stage = static_cast<StageNumber>(stage);
+	header.color = static_cast<PlayerColor>(color);
+
+	Array<Run> runs;
+	runs.reserve(runCount);
+	uint64 tickCount = 0;
+	for (uint32 i = 0; i < runCount; ++i)
+	{
+		Run run;
+		if (!reader.read(run.bits) || !reader.read(run.count))
+		{
+			return false;
+		}
+		tickCount += run.count;
+		runs << run;
+	}
+
+	// ヘッダーと中身のティック数が合わないファイルは壊れている
+	if (tickCount != header.tickCount)
+	{
+		return false;
+	}
+
+	m_header = header;
+	m_runs = std::move(runs);
+	rewind();
+	return true;
+}
+
+void InputReplay::rewind()
+{
+	m_playbackRun = 0;
+	m_playbackOffset = 0;
+	m_playbackTick = 0;
+}
+
+PlayerInput InputReplay::next()
+{
+	if (isFinished())
+	{
+		return PlayerInput{};
+	}
+
+	const Run& run = m_runs[m_playbackRun];
+	const PlayerInput input = Unpack(run.bits);
+
+	if (++m_playbackOffset >= run.count)
+	{
+		++m_playbackRun;
+		m_playbackOffset = 0;
+	}
+	++m_playbackTick;
+
+	return input;
+}
+
+uint8 InputReplay::Pack(const PlayerInput& input)
+{
+	uint8 bits = 0;
+	if (input.left) bits |= InputBit::Left;
+	if (input.right) bits |= InputBit::Right;
+	if (input.up) bits |= InputBit::Up;
+	if (input.down) bits |= InputBit::Down;
+	if (input.jumpPressed) bits |= InputBit::JumpPressed;
+	if (input.jumpDown) bits |= InputBit::JumpDown;
+	if (input.fireDown) bits |= InputBit::FireDown;
+	return bits;
+}
+
+PlayerInput InputReplay::Unpack(uint8 bits)
+{
+	PlayerInput input;
+	input.left = (bits & InputBit::Left) != 0;
+	input.right = (bits & InputBit::Right) != 0;
+	input.up = (bits & InputBit::Up) != 0;
+	input.down = (bits & InputBit::Down) != 0;
+	input.jumpPressed = (bits & InputBit::JumpPressed) != 0;
+	input.jumpDown = (bits & InputBit::JumpDown) != 0;
+	input.fireDown = (bits & InputBit::FireDown) != 0;
+	return input;
+}
@@ -0,0 +1,64 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include "PlayerInput.hpp"
+#include "PlayerColor.hpp"
+
+enum class StageNumber;
+
+// プレイヤー入力の記録と再生
+// 1ティックの入力を1バイトにまとめ、同じ入力が続く区間はランレングスで保存する
+// ステージ・キャラクター・乱数シードも一緒に保存し、同じビルドなら同じ結果を再現できる
+class InputReplay
+{
+public:
+	struct Header
+	{
+		StageNumber stage;
+		PlayerColor color = PlayerColor::Green;
+		uint64 seed = 0;
+		uint64 tickCount = 0;
+		Vec2 finalPlayerPosition = Vec2::Zero();  // 記録終了時のプレイヤー位置（再生結果の照合用）
+	};
+
+	InputReplay();
+
+	// 記録
+	void beginRecording(StageNumber stage, PlayerColor color, uint64 seed);
+	void record(const PlayerInput& input);
+	void setFinalPlayerPosition(const Vec2& position) { m_header.finalPlayerPosition = position; }
+	void clear();
+
+	// 保存・読み込み
+	bool save(FilePathView path) const;
+	bool load(FilePathView path);
+
+	// 再生（先頭から1ティックずつ取り出す）
+	void rewind();
+	bool isFinished() const { return m_playbackTick >= m_header.tickCount; }
+	PlayerInput next();
+
+	const Header& getHeader() const { return m_header; }
+	uint64 getTickCount() const { return m_header.tickCount; }
+
+private:
+	struct Run
+	{
+		uint8 bits = 0;
+		uint16 count = 0;
+	};
+
+	static constexpr uint32 FILE_MAGIC = 0x50524441;  // "ADRP"
+	static constexpr uint32 FILE_VERSION = 1;
+	static constexpr size_t RESERVED_RUNS = 8192;  // 記録開始時に確保する区間数（入力が変わるたびに1区間増える）
+
+	Header m_header;
+	Array<Run> m_runs;
+
+	// 再生位置
+	size_t m_playbackRun;
+	uint16 m_playbackOffset;
+	uint64 m_playbackTick;
+
+	static uint8 Pack(const PlayerInput& input);
+	static PlayerInput Unpack(uint8 bits);
+};
@@ -1,6 +1,7 @@
 ﻿#include "Player.hpp"
+#include "../Core/FontRegistry.hpp"
 #include "../Sound/SoundManager.hpp"
-#include "../Systems/GamepadSystem.hpp"
+#include "../Core/SimulationClock.hpp"
 
 Player::Player()
 	: m_color(PlayerColor::Green)
@@ -17,6 +18,8 @@ Player::Player()
 	, m_isExploding(false)
 	, m_explosionTimer(0.0)
 	, m_deathTimer(0.0)
+	, m_explosionParticles(EXPLOSION_PARTICLE_COUNT, ParticlePool::Motion{ Vec2(0.0, PARTICLE_GRAVITY), Vec2(0.98, 0.98), 0.995, 0.5 })
+	, m_previousTickPosition(Vec2::Zero())
 	, m_fireballCount(0)
 	, m_isHipDropping(false)
 	, m_hipDropTimer(0.0)
@@ -43,6 +46,8 @@ Player::Player(PlayerColor color, const Vec2& startPosition)
 	, m_isExploding(false)
 	, m_explosionTimer(0.0)
 	, m_deathTimer(0.0)
+	, m_explosionParticles(EXPLOSION_PARTICLE_COUNT, ParticlePool::Motion{ Vec2(0.0, PARTICLE_GRAVITY), Vec2(0.98, 0.98), 0.995, 0.5 })
+	, m_previousTickPosition(startPosition)
 	, m_fireballCount(0)
 {
 	// パーティクル配列をクリア
@@ -61,6 +66,7 @@ void Player::init(PlayerColor color, const Vec2& startPosition)
 	m_color = color;
 	m_stats = getPlayerStats(color);
 	m_position = startPosition;
+	m_previousTickPosition = startPosition;
 	m_velocity = Vec2::Zero();
 	m_currentState = PlayerState::Idle;
 	m_direction = PlayerDirection::Right;
@@ -89,27 +95,29 @@ void Player::init(PlayerColor color, const Vec2& startPosition)
 
 void Player::loadTextures()
 {
-	m_textures.clear();
+	m_sprites.fill(Texture{});
+	m_textureLease.releaseAll();
 
 	const String colorStr = getColorString();
 	const String basePath = U"Sprites/Characters/";
 
 	// 既存のテクスチャ読み込み...
-	Array<String> actions = {
-		U"duck", U"front", U"hit", U"idle", U"jump",
-		U"climb_a", U"climb_b", U"walk_a", U"walk_b"
+	const std::pair<PlayerSprite, StringView> actions[] = {
+		{ PlayerSprite::Duck, U"duck" }, { PlayerSprite::Front, U"front" }, { PlayerSprite::Hit, U"hit" },
+		{ PlayerSprite::Idle, U"idle" }, { PlayerSprite::Jump, U"jump" },
+		{ PlayerSprite::ClimbA, U"climb_a" }, { PlayerSprite::ClimbB, U"climb_b" },
+		{ PlayerSprite::WalkA, U"walk_a" }, { PlayerSprite::WalkB, U"walk_b" }
 	};
 
-	for (const auto& action : actions)
+	for (const auto& [sprite, action] : actions)
 	{
 		const String filename = U"character_{}_{}.png"_fmt(colorStr, action);
 		const String filepath = basePath + filename;
-		const String key = action;
 
-		Texture texture(filepath);
+		const Texture texture = m_textureLease.acquire(filepath);
 		if (texture)
 		{
-			m_textures[key] = texture;
+			m_sprites[static_cast<size_t>(sprite)] = texture;
 		}
 		else
 		{
@@ -117,8 +125,18 @@ void Player::loadTextures()
 		}
 	}
 
+	// 読み込めなかったスプライトは idle で代用（描画時の存在チェックを省く）
+	const Texture& idle = getSprite(PlayerSprite::Idle);
+	for (auto& texture : m_sprites)
+	{
+		if (!texture)
+		{
+			texture = idle;
+		}
+	}
+
 	// ★ ファイアボールテクスチャの読み込み
-	m_fireballTexture = Texture(U"Sprites/Tiles/fireball.png");
+	m_fireballTexture = m_textureLease.acquire(U"Sprites/Tiles/fireball.png");
 	if (!m_fireballTexture)
 	{
 		Print << U"Failed to load fireball texture";
@@ -127,7 +145,7 @@ void Player::loadTextures()
 
 void Player::update()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	// ★ 追加: 前フレームの位置を記録
 	m_previousPosition = m_position;
@@ -228,12 +246,12 @@ void Player::draw() const
 		MAX_FIREBALLS_PER_STAGE,
 		m_fireballs.size()
 	);
-	Font(16)(debugText).draw(m_position.x - 70, m_position.y - 60, ColorF(1.0, 1.0, 1.0));
+	FontRegistry::Get(16)(debugText).draw(m_position.x - 70, m_position.y - 60, ColorF(1.0, 1.0, 1.0));
 
 	const String statsText = U"Move:{:.1f} Jump:{:.1f} Life:{} Size:60x60"_fmt(
 		m_stats.moveSpeed, m_stats.jumpPower, m_stats.maxLife
 	);
-	Font(14)(statsText).draw(m_position.x - 70, m_position.y - 45, ColorF(0.8, 0.8, 1.0));
+	FontRegistry::Get(14)(statsText).draw(m_position.x - 70, m_position.y - 45, ColorF(0.8, 0.8, 1.0));
 
 	// 衝突判定の可視化（開発用）
 	const double PLAYER_SIZE = 60.0;
@@ -247,7 +265,7 @@ void Player::draw() const
 		if (m_fireballs[i].active)
 		{
 			const String fbInfo = U"FB{}:({:.0f},{:.0f})"_fmt(i, m_fireballs[i].position.x, m_fireballs[i].position.y);
-			Font(12)(fbInfo).draw(m_position.x - 70, m_position.y - 30 + i * 15, ColorF(1.0, 1.0, 0.0));
+			FontRegistry::Get(12)(fbInfo).draw(m_position.x - 70, m_position.y - 30 + i * 15, ColorF(1.0, 1.0, 0.0));
 		}
 	}
 #endif
@@ -286,10 +304,21 @@ void Player::updatePhysics()
 	updateBasicPhysics();
 }
 
+void Player::setInput(const PlayerInput& input)
+{
+	// 押した瞬間の入力はティックで消費されるまで残す
+	const bool jumpDown = m_input.jumpDown || input.jumpDown;
+	const bool fireDown = m_input.fireDown || input.fireDown;
+
+	m_input = input;
+	m_input.jumpDown = jumpDown;
+	m_input.fireDown = fireDown;
+}
+
 void Player::updateBasicPhysics()
 {
 	const double BLOCK_SIZE = 64.0;
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	// ★ 改善された重力システム
 	if (!m_isGrounded)
@@ -329,20 +358,19 @@ void Player::handleInput()
 
 	const double BLOCK_SIZE = 64.0;
 
-	// 入力状態の取得
-	const Pad::PS4Pad pad{ 0, 0.25 }; // プレイヤー0 / デッドゾーンお好みで
+	// 入力状態の取得（setInput() で設定されたもの）
+	const bool leftPressed = m_input.left;
+	const bool rightPressed = m_input.right;
+	const bool downPressed = m_input.down;
+	const bool upPressed = m_input.up;
+	bool hasHorizontalInput = m_input.hasHorizontal();
+	const bool jumpPressed = m_input.jumpPressed;
 
-	const bool leftPressed = KeyLeft.pressed() || KeyA.pressed() || pad.leftPressed();
-	const bool rightPressed = KeyRight.pressed() || KeyD.pressed() || pad.rightPressed();
-	const bool downPressed = KeyDown.pressed() || KeyS.pressed() || pad.downPressed();
-	const bool upPressed = KeyUp.pressed() || KeyW.pressed() || pad.upPressed();
-	bool hasHorizontalInput = leftPressed || rightPressed;
-	// ジャンプは Space/↑/W/×
-	const bool jumpPressed = KeySpace.pressed() || KeyUp.pressed() || KeyW.pressed() || pad.squarePressed();
-	const bool jumpDown = KeySpace.down() || KeyUp.down() || KeyW.down() || pad.squareDown();
-
-	// 攻撃は F/〇（必要なら□/△も割り当て）
-	const bool fireDown = KeyF.down() || pad.circleDown();
+	// 押した瞬間の入力はこのティックで消費する
+	const bool jumpDown = m_input.jumpDown;
+	const bool fireDown = m_input.fireDown;
+	m_input.jumpDown = false;
+	m_input.fireDown = false;
 
 
 	// 方向設定
@@ -489,8 +517,7 @@ void Player::checkBasicGroundCollision()
 		if (m_currentState == PlayerState::Jump)
 		{
 			// 移動入力があるかチェック
-			bool hasMovementInput = (KeyLeft.pressed() || KeyA.pressed() ||
-									KeyRight.pressed() || KeyD.pressed());
+			bool hasMovementInput = m_input.hasHorizontal();
 
 			if (hasMovementInput)
 			{
@@ -556,9 +583,8 @@ void Player::updateStateTransitions()
 	else if (m_isGrounded && m_currentState == PlayerState::Jump)
 	{
 		// 着地時の状態遷移
-		bool downPressed = KeyDown.pressed() || KeyS.pressed();
-		bool hasHorizontalInput = KeyLeft.pressed() || KeyA.pressed() ||
-			KeyRight.pressed() || KeyD.pressed();
+		bool downPressed = m_input.down;
+		bool hasHorizontalInput = m_input.hasHorizontal();
 
 		if (downPressed)
 		{
@@ -577,7 +603,7 @@ void Player::updateStateTransitions()
 	// ジャンプ状態タイマーの更新
 	if (m_jumpStateTimer > 0.0)
 	{
-		m_jumpStateTimer -= Scene::DeltaTime();
+		m_jumpStateTimer -= SimulationClock::DeltaTime();
 	}
 }
 
@@ -602,9 +628,8 @@ void Player::updateGroundStateTransitions()
 		if (m_currentState == PlayerState::Jump)
 		{
 			// ジャンプから着地
-			bool hasMovementInput = (KeyLeft.pressed() || KeyA.pressed() ||
-									KeyRight.pressed() || KeyD.pressed());
-			bool isDucking = (KeyDown.pressed() || KeyS.pressed());
+			bool hasMovementInput = m_input.hasHorizontal();
+			bool isDucking = m_input.down;
 
 			if (isDucking)
 			{
@@ -636,7 +661,7 @@ void Player::updateInvincibility()
 {
 	if (m_isInvincible)
 	{
-		m_invincibleTimer += Scene::DeltaTime();
+		m_invincibleTimer += SimulationClock::DeltaTime();
 
 		// 無敵時間が終了したら無敵状態を解除（特性を適用した時間）
 		if (m_invincibleTimer >= getActualInvincibleDuration())
@@ -655,56 +680,32 @@ void Player::updateAnimation()
 
 Texture Player::getCurrentTexture() const
 {
-	String textureKey;
-
 	switch (m_currentState)
 	{
-	case PlayerState::Idle:
-		textureKey = U"idle";
-		break;
 	case PlayerState::Front:
-		textureKey = U"front";
-		break;
+		return getSprite(PlayerSprite::Front);
 	case PlayerState::Walk:
 	{
 		const bool useVariantA = std::fmod(m_animationTimer, WALK_ANIMATION_SPEED * 2) < WALK_ANIMATION_SPEED;
-		textureKey = useVariantA ? U"walk_a" : U"walk_b";
+		return getSprite(useVariantA ? PlayerSprite::WalkA : PlayerSprite::WalkB);
 	}
-	break;
 	case PlayerState::Jump:
-		textureKey = U"jump";
-		break;
+		return getSprite(PlayerSprite::Jump);
 	case PlayerState::Duck:
-		textureKey = U"duck";
-		break;
+		return getSprite(PlayerSprite::Duck);
 	case PlayerState::Hit:
-		textureKey = U"hit";
-		break;
+		return getSprite(PlayerSprite::Hit);
 	case PlayerState::Climb:
 	{
 		const bool useVariantA = std::fmod(m_animationTimer, CLIMB_ANIMATION_SPEED * 2) < CLIMB_ANIMATION_SPEED;
-		textureKey = useVariantA ? U"climb_a" : U"climb_b";
+		return getSprite(useVariantA ? PlayerSprite::ClimbA : PlayerSprite::ClimbB);
 	}
-	break;
 	case PlayerState::Exploding:
 	case PlayerState::Dead:
 		return Texture{};
+	case PlayerState::Idle:
 	default:
-		textureKey = U"idle";
-		break;
-	}
-
-	if (m_textures.contains(textureKey))
-	{
-		return m_textures.at(textureKey);
-	}
-	else
-	{
-		if (m_textures.contains(U"idle"))
-		{
-			return m_textures.at(U"idle");
-		}
-		return Texture{};
+		return getSprite(PlayerSprite::Idle);
 	}
 }
 
@@ -752,7 +753,7 @@ ColorF Player::getTint() const
 
 void Player::applyGravity()
 {
-	m_velocity.y += GRAVITY * Scene::DeltaTime();
+	m_velocity.y += GRAVITY * SimulationClock::DeltaTime();
 }
 
 void Player::jump()
@@ -835,7 +836,7 @@ void Player::startExplosion()
 // 爆散状態の更新
 void Player::updateExplosion()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	m_explosionTimer += deltaTime;
 	m_deathTimer += deltaTime;
@@ -860,8 +861,8 @@ void Player::createExplosionParticles()
 	for (int i = 0; i < EXPLOSION_PARTICLE_COUNT; ++i)
 	{
 		// ランダムな方向と速度
-		const double angle = Random(0.0, Math::TwoPi);
-		const double speed = Random(100.0, 300.0);
+		const double angle = GameRandom::Range(0.0, Math::TwoPi);
+		const double speed = GameRandom::Range(100.0, 300.0);
 		const Vec2 velocity = Vec2(std::cos(angle), std::sin(angle)) * speed;
 
 		// プレイヤーの色に応じたパーティクル色
@@ -877,17 +878,29 @@ void Player::createExplosionParticles()
 		}
 
 		// 少しランダム性を加える
-		particleColor.r += Random(-0.2, 0.2);
-		particleColor.g += Random(-0.2, 0.2);
-		particleColor.b += Random(-0.2, 0.2);
+		particleColor.r += GameRandom::Range(-0.2, 0.2);
+		particleColor.g += GameRandom::Range(-0.2, 0.2);
+		particleColor.b += GameRandom::Range(-0.2, 0.2);
 		particleColor.r = Math::Clamp(particleColor.r, 0.0, 1.0);
 		particleColor.g = Math::Clamp(particleColor.g, 0.0, 1.0);
 		particleColor.b = Math::Clamp(particleColor.b, 0.0, 1.0);
 
 		// パーティクルの初期位置（プレイヤー周辺）
-		const Vec2 startPos = m_position + Vec2(Random(-15.0, 15.0), Random(-20.0, 10.0));
-
-		m_explosionParticles.emplace_back(startPos, velocity, particleColor);
+		// （引数の評価順は不定なので、乱数は1つずつ取り出す）
+		const double offsetX = GameRandom::Range(-15.0, 15.0);
+		const double offsetY = GameRandom::Range(-20.0, 10.0);
+		const Vec2 startPos = m_position + Vec2(offsetX, offsetY);
+
+		ParticlePool::Particle particle;
+		particle.position = startPos;
+		particle.velocity = velocity;
+		particle.color = particleColor;
+		particle.life = GameRandom::Range(0.8, 1.5);
+		particle.size = GameRandom::Range(3.0, 8.0);
+		particle.rotation = GameRandom::Range(0.0, Math::TwoPi);
+		particle.rotationSpeed = GameRandom::Range(-10.0, 10.0);
+
+		m_explosionParticles.spawn(particle);
 	}
 }
 
@@ -908,42 +921,14 @@ void Player::createShockwaves()
 // 爆散パーティクルの更新
 void Player::updateExplosionParticles()
 {
-	const double deltaTime = Scene::DeltaTime();
-
-	for (auto it = m_explosionParticles.begin(); it != m_explosionParticles.end();)
-	{
-		auto& particle = *it;
-
-		// 物理更新
-		particle.position += particle.velocity * deltaTime;
-		particle.velocity.y += PARTICLE_GRAVITY * deltaTime; // 重力適用
-		particle.velocity *= 0.98; // 空気抵抗
-
-		// 回転更新
-		particle.rotation += particle.rotationSpeed * deltaTime;
-
-		// 生存時間更新
-		particle.life -= deltaTime;
-
-		// サイズの変化
-		particle.size *= 0.995;
-
-		// 寿命が尽きたパーティクルを削除
-		if (particle.life <= 0.0 || particle.size <= 0.5)
-		{
-			it = m_explosionParticles.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
+	// 重力・空気抵抗・縮小・寿命切れの削除はプール側で行う
+	m_explosionParticles.update(SimulationClock::DeltaTime());
 }
 
 // 衝撃波の更新
 void Player::updateShockwaves()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	for (size_t i = 0; i < m_shockwaveTimers.size();)
 	{
@@ -988,20 +973,22 @@ void Player::drawExplosionEffect() const
 // 爆散パーティクルの描画
 void Player::drawExplosionParticles() const
 {
-	for (const auto& particle : m_explosionParticles)
+	for (size_t i = 0; i < m_explosionParticles.size(); ++i)
 	{
-		const double alpha = particle.life / particle.maxLife;
-		const ColorF color = ColorF(particle.color.r, particle.color.g, particle.color.b, alpha);
+		const Vec2 position = m_explosionParticles.getPosition(i);
+		const double alpha = m_explosionParticles.getLifeRatio(i);
+		const ColorF& baseColor = m_explosionParticles.getColor(i);
+		const ColorF color = ColorF(baseColor.r, baseColor.g, baseColor.b, alpha);
 
 		// パーティクルを回転する矩形として描画
-		const double size = particle.size;
-		const RectF particleRect(particle.position.x - size / 2, particle.position.y - size / 2, size, size);
+		const double size = m_explosionParticles.getSize(i);
+		const RectF particleRect(position.x - size / 2, position.y - size / 2, size, size);
 
 		// 簡易的な回転描画（矩形）
 		RectF(particleRect).draw(color);
 
 		// 光る効果
-		Circle(particle.position, size * 0.6).draw(ColorF(color.r, color.g, color.b, alpha * 0.3));
+		Circle(position, size * 0.6).draw(ColorF(color.r, color.g, color.b, alpha * 0.3));
 	}
 }
 
@@ -1053,16 +1040,6 @@ String Player::getStateString() const
 	}
 }
 
-String Player::buildTextureKey(const String& action) const
-{
-	return action;
-}
-
-String Player::buildTextureKey(const String& action, const String& variant) const
-{
-	return U"{}_{}"_fmt(action, variant);
-}
-
 // ★ 新しいファイアボール関連メソッドの実装
 void Player::fireFireball()
 {
@@ -1103,7 +1080,7 @@ void Player::fireFireball()
 
 void Player::updateFireballs()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	for (auto it = m_fireballs.begin(); it != m_fireballs.end();)
 	{
@@ -1228,7 +1205,7 @@ void Player::updateHipDrop()
 {
 	if (!m_isHipDropping) return;
 
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 	m_hipDropTimer += deltaTime;
 
 	// 最大時間または地面に着地したら終了
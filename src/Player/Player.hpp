@@ -1,7 +1,12 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
 #include "../Player/PlayerColor.hpp"
+#include "PlayerInput.hpp"
+#include "../Core/GameRandom.hpp"
+#include "../Core/TextureCache.hpp"
 #include "../Systems/TutorialEvents.hpp"
+#include "../Effects/ParticlePool.hpp"
+#include <array>
 
 // プレイヤーのアニメーション状態
 enum class PlayerState
@@ -18,6 +23,22 @@ enum class PlayerState
 	Dead        // 死亡状態
 };
 
+// プレイヤーのスプライト（読み込み時に解決し、描画時は添字で引く）
+enum class PlayerSprite : uint8
+{
+	Idle,
+	Front,
+	Duck,
+	Hit,
+	Jump,
+	WalkA,
+	WalkB,
+	ClimbA,
+	ClimbB,
+
+	Count
+};
+
 // プレイヤーの向き
 enum class PlayerDirection
 {
@@ -55,7 +76,9 @@ private:
 	PlayerDirection m_direction;
 
 	// スプライト関連
-	HashTable<String, Texture> m_textures;
+	static constexpr size_t PLAYER_SPRITE_COUNT = static_cast<size_t>(PlayerSprite::Count);
+	std::array<Texture, PLAYER_SPRITE_COUNT> m_sprites;
+	TextureLease m_textureLease;
 	double m_animationTimer;
 	double m_stateTimer;
 	bool m_isGrounded;
@@ -70,34 +93,17 @@ private:
 	double m_deathTimer;
 
 	// パーティクルシステム
-	struct ExplosionParticle
-	{
-		Vec2 position;
-		Vec2 velocity;
-		double life;
-		double maxLife;
-		double size;
-		ColorF color;
-		double rotation;
-		double rotationSpeed;
-
-		ExplosionParticle(const Vec2& pos, const Vec2& vel, const ColorF& col)
-			: position(pos), velocity(vel), color(col)
-			, life(Random(0.8, 1.5)), maxLife(life)
-			, size(Random(3.0, 8.0))
-			, rotation(Random(0.0, Math::TwoPi))
-			, rotationSpeed(Random(-10.0, 10.0))
-		{
-		}
-	};
-
-	Array<ExplosionParticle> m_explosionParticles;
+	ParticlePool m_explosionParticles;
 	Array<Vec2> m_shockwaves;
 	Array<double> m_shockwaveTimers;
 
 	Vec2 m_previousPosition;  // 前フレームの位置
 	bool m_wasMovingUp;       // 前フレームで上向きに移動していたか
 
+	// 固定ティック対応
+	Vec2 m_previousTickPosition;  // 描画補間用：直前のティック開始時の位置
+	PlayerInput m_input;          // 現在の入力（押した瞬間の入力は次のティックで消費）
+
 
 	// ファイアボール関連のメンバー変数
 	Array<Fireball> m_fireballs;
@@ -185,6 +191,14 @@ public:
 	Vec2 getVelocity() const { return m_velocity; }
 	void setVelocity(const Vec2& velocity) { m_velocity = velocity; }
 
+	// 描画補間（ティック開始時に位置を保存し、描画時に前後のティック間を補間する）
+	void savePreviousTickPosition() { m_previousTickPosition = m_position; }
+	Vec2 getInterpolatedPosition(double alpha) const { return m_previousTickPosition.lerp(m_position, alpha); }
+
+	// 入力の設定：押した瞬間の入力は消費されるまで保持する（ティック数が 0 回や複数回のフレームでも 1 回だけ処理）
+	void setInput(const PlayerInput& input);
+	const PlayerInput& getInput() const { return m_input; }
+
 	// 物理
 	void applyGravity();
 	bool isGrounded() const { return m_isGrounded; }
@@ -248,8 +262,7 @@ private:
 	void updateStateTransitions();
 	void updateGroundStateTransitions();
 	void updateInvincibility();
-	String buildTextureKey(const String& action) const;
-	String buildTextureKey(const String& action, const String& variant) const;
+	const Texture& getSprite(PlayerSprite sprite) const { return m_sprites[static_cast<size_t>(sprite)]; }
 
 	// 特性を適用した値を取得
 	double getActualMoveSpeed() const { return BASE_MOVE_SPEED * m_stats.moveSpeed; }
@@ -0,0 +1,38 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+#include "../Systems/GamepadSystem.hpp"
+
+// 1ティック分のプレイヤー入力
+// 押し続け（pressed）と押した瞬間（down）を分けて持ち、シミュレーションはデバイスを直接読まない
+struct PlayerInput
+{
+	bool left = false;
+	bool right = false;
+	bool up = false;
+	bool down = false;
+	bool jumpPressed = false;
+	bool jumpDown = false;
+	bool fireDown = false;
+
+	// キーボード・ゲームパッドの現在の状態から入力を作る
+	static PlayerInput FromDevices()
+	{
+		const Pad::PS4Pad pad{ 0, 0.25 }; // プレイヤー0 / デッドゾーンお好みで
+
+		PlayerInput input;
+		input.left = KeyLeft.pressed() || KeyA.pressed() || pad.leftPressed();
+		input.right = KeyRight.pressed() || KeyD.pressed() || pad.rightPressed();
+		input.down = KeyDown.pressed() || KeyS.pressed() || pad.downPressed();
+		input.up = KeyUp.pressed() || KeyW.pressed() || pad.upPressed();
+
+		// ジャンプは Space/↑/W/□
+		input.jumpPressed = KeySpace.pressed() || KeyUp.pressed() || KeyW.pressed() || pad.squarePressed();
+		input.jumpDown = KeySpace.down() || KeyUp.down() || KeyW.down() || pad.squareDown();
+
+		// 攻撃は F/〇
+		input.fireDown = KeyF.down() || pad.circleDown();
+		return input;
+	}
+
+	bool hasHorizontal() const { return left || right; }
+};
@@ -1,4 +1,6 @@
 ﻿#include "CharacterSelectScene.hpp"
+#include "../Core/FontRegistry.hpp"
+#include "../Core/MemoryArena.hpp"
 #include "../Sound/SoundManager.hpp"
 #include "../Core/SceneFactory.hpp"
 
@@ -36,9 +38,9 @@ void CharacterSelectScene::init()
 	loadPlayerTextures();
 
 	// フォントの初期化
-	m_titleFont = Font(36, Typeface::Bold);
-	m_labelFont = Font(24);
-	m_buttonFont = Font(20, Typeface::Bold);
+	m_titleFont = FontRegistry::Get(36, Typeface::Bold);
+	m_labelFont = FontRegistry::Get(24);
+	m_buttonFont = FontRegistry::Get(20, Typeface::Bold);
 
 	// タイトルBGMが再生されていない場合は開始
 	SoundManager& soundManager = SoundManager::GetInstance();
@@ -444,15 +446,15 @@ void CharacterSelectScene::drawCharacterStats() const
 
 	// キャラクター名
 	const Vec2 namePos = Vec2(panelRect.center().x, panelY + 40);
-	Font(28, Typeface::Bold)(getColorName(selectedColor)).drawAt(namePos, getColorTint(selectedColor));
+	FontRegistry::Get(28, Typeface::Bold)(getColorName(selectedColor)).drawAt(namePos, getColorTint(selectedColor));
 
 	// 特性名
 	const Vec2 traitPos = Vec2(panelRect.center().x, panelY + 80);
-	Font(20, Typeface::Bold)(stats.trait).drawAt(traitPos, ColorF(1.0, 1.0, 0.8));
+	FontRegistry::Get(20, Typeface::Bold)(stats.trait).drawAt(traitPos, ColorF(1.0, 1.0, 0.8));
 
 	// 説明文
 	const Vec2 descPos = Vec2(panelRect.center().x, panelY + 110);
-	Font(16)(stats.description).drawAt(descPos, ColorF(0.9, 0.9, 0.9));
+	FontRegistry::Get(16)(stats.description).drawAt(descPos, ColorF(0.9, 0.9, 0.9));
 
 	// ステータス表示（アニメーション値を使用）
 	const double statsStartY = panelY + 160;
@@ -475,7 +477,7 @@ void CharacterSelectScene::drawCharacterStats() const
 	const String numericText = U"数値: 移動{:.1f} ジャンプ{:.1f} 無敵{:.1f}s"_fmt(
 		stats.moveSpeed, stats.jumpPower, stats.invincibleTime * 2.0
 	);
-	Font(12)(numericText).drawAt(numericPos, ColorF(0.7, 0.7, 0.7));
+	FontRegistry::Get(12)(numericText).drawAt(numericPos, ColorF(0.7, 0.7, 0.7));
 
 	// おすすめプレイヤータイプ
 	const Vec2 recommendPos = Vec2(panelRect.center().x, panelY + 350);
@@ -488,7 +490,7 @@ void CharacterSelectScene::drawCharacterStats() const
 	case PlayerColor::Beige:  recommend = U"安全重視の方に"; break;
 	case PlayerColor::Yellow: recommend = U"上級者向け"; break;
 	}
-	Font(14)(recommend).drawAt(recommendPos, ColorF(0.8, 0.8, 1.0));
+	FontRegistry::Get(14)(recommend).drawAt(recommendPos, ColorF(0.8, 0.8, 1.0));
 }
 
 void CharacterSelectScene::drawAnimatedStatBar(const String& label, double normalizedValue, double centerX, double y, const ColorF& color) const
@@ -501,7 +503,7 @@ void CharacterSelectScene::drawAnimatedStatBar(const String& label, double norma
 	const double clampedValue = Math::Clamp(normalizedValue, 0.0, 1.0);
 
 	// ラベル
-	Font(16)(label).draw(barX, y - 20, ColorF(0.9, 0.9, 0.9));
+	FontRegistry::Get(16)(label).draw(barX, y - 20, ColorF(0.9, 0.9, 0.9));
 
 	// バー背景
 	RectF(barX, y, barWidth, barHeight).draw(ColorF(0.2, 0.2, 0.2));
@@ -535,7 +537,7 @@ void CharacterSelectScene::drawStatBar(const String& label, int value, int maxVa
 	const double barX = centerX - barWidth / 2;
 
 	// ラベル
-	Font(16)(label).draw(barX, y - 20, ColorF(0.9, 0.9, 0.9));
+	FontRegistry::Get(16)(label).draw(barX, y - 20, ColorF(0.9, 0.9, 0.9));
 
 	// バー背景
 	RectF(barX, y, barWidth, barHeight).draw(ColorF(0.2, 0.2, 0.2));
@@ -708,7 +710,8 @@ void CharacterSelectScene::drawPentagonTracePath() const
 	const double angleStep = Math::TwoPi / numPoints;
 	const double time = m_animationTimer;
 
-	Array<Vec2> points;
+	ScratchArray<Vec2> points = FrameScratch::MakeArray<Vec2>();
+	points.reserve(numPoints);
 	for (int i = 0; i < numPoints; ++i)
 	{
 		const double angle = i * angleStep - Math::HalfPi;
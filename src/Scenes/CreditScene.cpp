@@ -1,6 +1,7 @@
 ﻿#include "CreditScene.hpp"
 #include "../Sound/SoundManager.hpp"
 #include "../Core/SceneFactory.hpp"
+#include "../Core/FontRegistry.hpp"
 
 namespace {
 	const bool registered = [] {
@@ -29,10 +30,10 @@ void CreditScene::init()
 	m_buttonTexture = Texture(U"UI/PNG/Yellow/button_rectangle_depth_gradient.png");
 
 	// フォントの初期化
-	m_titleFont = Font(48, Typeface::Bold);
-	m_categoryFont = Font(28, Typeface::Bold);
-	m_nameFont = Font(20);
-	m_buttonFont = Font(20, Typeface::Bold);
+	m_titleFont = FontRegistry::Get(48, Typeface::Bold);
+	m_categoryFont = FontRegistry::Get(28, Typeface::Bold);
+	m_nameFont = FontRegistry::Get(20);
+	m_buttonFont = FontRegistry::Get(20, Typeface::Bold);
 
 	// タイトルBGMが再生されていない場合は開始
 	SoundManager& soundManager = SoundManager::GetInstance();
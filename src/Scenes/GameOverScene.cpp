@@ -2,6 +2,7 @@
 #include "GameScene.hpp"
 #include "../Sound/SoundManager.hpp"
 #include "../Core/SceneFactory.hpp"
+#include "../Core/FontRegistry.hpp"
 
 namespace {
 	const bool registered = [] {
@@ -27,9 +28,9 @@ void GameOverScene::init()
 	loadTextures();
 
 	// フォントの初期化
-	m_titleFont = Font(36, Typeface::Bold);
-	m_messageFont = Font(24);
-	m_buttonFont = Font(20, Typeface::Bold);
+	m_titleFont = FontRegistry::Get(36, Typeface::Bold);
+	m_messageFont = FontRegistry::Get(24);
+	m_buttonFont = FontRegistry::Get(20, Typeface::Bold);
 
 	// GameSceneからデータを取得
 	m_currentStage = GameScene::getGameOverStage();  // ゲームオーバーしたステージを取得
@@ -247,7 +248,7 @@ void GameOverScene::drawTitle() const
 	// 脈動効果
 	const double pulse = 0.8 + 0.2 * std::sin(m_animationTimer * 3.0);
 	const double pulseSize = 52.0 * pulse;
-	Font(static_cast<int>(pulseSize), Typeface::Bold)(title).drawAt(titlePos, ColorF(1.0, 0.4, 0.4, 0.3));
+	FontRegistry::Get(52, Typeface::Bold)(title).drawAt(pulseSize, titlePos, ColorF(1.0, 0.4, 0.4, 0.3));
 }
 
 void GameOverScene::drawStageInfo() const
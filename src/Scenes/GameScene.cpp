@@ -29,28 +29,19 @@ GameScene::GameScene(StageNumber stage)
 	, m_player(nullptr)
 	, m_stage(nullptr)
 	, m_currentStageNumber(stage)
+	, m_enemies(EnemyPool::Shared())
 	, m_goalReached(false)
 	, m_goalTimer(0.0)
+	, m_fireballParticles(FIREBALL_PARTICLE_CAPACITY, ParticlePool::Motion{ Vec2(0.0, 400.0), Vec2(0.98, 0.98), 0.996, 0.5 })
 	, m_isLastStage(false)
 	, m_fromResultScene(false)
+	, m_saveSessionReplay(false)
 {
 }
 
 void GameScene::init()
 {
-	// 背景画像の読み込み
-	m_backgroundTexture = Texture(U"Sprites/Backgrounds/background_fade_mushrooms.png");
-
-	// 黒い炎テクスチャの読み込み
-	m_blackFireTexture = Texture(U"Sprites/BlackFire.png");
-	if (!m_blackFireTexture)
-	{
-		Print << U"Failed to load BlackFire.png";
-	}
-
-
-	// フォントの初期化
-	m_gameFont = Font(24);
+	initRendering();
 
 	// ゲームBGMを開始
 	SoundManager::GetInstance().playBGM(SoundManager::SoundType::BGM_GAME);
@@ -72,8 +63,67 @@ void GameScene::init()
 		s_shouldRetryStage = false;
 	}
 
+	// ゲームプレイ部分の初期化（乱数シードはセッションごとに変え、リプレイ用に記録する）
+	initSimulation(targetStage, RandomUint64());
+	m_saveSessionReplay = true;
+}
+
+void GameScene::initRendering()
+{
+	// 背景画像の読み込み
+	m_backgroundTexture = m_textureLease.acquire(U"Sprites/Backgrounds/background_fade_mushrooms.png");
+
+	// 黒い炎テクスチャの読み込み（DayNightSystem と共有）
+	m_blackFireTexture = m_textureLease.acquire(U"Sprites/BlackFire.png");
+	if (!m_blackFireTexture)
+	{
+		Print << U"Failed to load BlackFire.png";
+	}
+
+
+	// フォントの初期化
+	m_gameFont = FontRegistry::Get(24);
+	m_profilerFont = FontRegistry::Get(13);
+
+	// 固定の案内文は組み済みのテキストを使い回す
+	m_controlText = CachedText{ m_gameFont };
+	m_controlText.set(U"WASD: Move, SPACE: Jump, S: Duck, F: Fireball, ESC: Title, R: Character Select");
+	m_gameOverText = CachedText{ FontRegistry::Get(32, Typeface::Bold) };
+	m_gameOverText.set(U"GAME OVER...");
+	m_timeText = GlyphText{ m_gameFont };
+	m_nightWarningText = CachedText{ FontRegistry::Get(28, Typeface::Bold) };
+	m_nightWarningText.set(U"NIGHT TIME - Enemies are aggressive!");
+	m_sunsetCautionText = CachedText{ FontRegistry::Get(20) };
+	m_sunsetCautionText.set(U"SUNSET TIME - Be cautious");
+
+	m_shaderEffects = m_arena.create<ShaderEffects>();
+	m_shaderEffects->init();
+
+	// ポストエフェクトは画面のエフェクト → 昼夜の色調の順に重ねる
+	m_postProcess = m_arena.create<PostProcessChain>();
+	m_postProcess->init();
+	m_shaderEffects->registerStages(*m_postProcess);
+
+	m_postProcess->addStage(PostProcessChain::Stage{
+		.name = U"DayNight",
+		.isEnabled = [this]() { return (m_dayNightSystem != nullptr); },
+		.fused = PostProcessChain::FusedStage::DayNight,
+		.writeParams = [this](PostProcessChain::FusedParams& params) {
+			m_dayNightSystem->writePostProcessParams(params);
+		} });
+}
+
+void GameScene::initSimulation(StageNumber stageNumber, uint64 seed)
+{
+	// ゲームプレイ用の乱数はセッションのシードから生成する
+	GameRandom::Reseed(seed);
+
+	// ブロードフェーズはステージ読み込み時にグリッドを構築するため先に作成
+	m_broadphase = m_arena.create<BroadphaseSystem>();
+	m_chaseField = m_arena.create<ChaseFieldSystem>();
+
 	// ステージの読み込み
-	loadStage(targetStage);
+	loadStage(stageNumber);
 
 	// プレイヤーオブジェクトを完全に破棄して再作成
 	if (m_player)
@@ -91,10 +141,10 @@ void GameScene::init()
 	// 地面のY座標は 13 * 64 = 832、プレイヤーの中心を地面から32px上に配置
 	const Vec2 startPosition = Vec2(3.0 * BLOCK_SIZE, 12.5 * BLOCK_SIZE); // 地面の上に立つ位置
 
-	m_player = std::make_unique<Player>(selectedColor, startPosition);
+	m_player = m_arena.create<Player>(selectedColor, startPosition);
 
 	// HUDシステムの初期化
-	m_hudSystem = std::make_unique<HUDSystem>();
+	m_hudSystem = m_arena.create<HUDSystem>();
 	m_hudSystem->init();
 	m_hudSystem->setPlayerCharacter(selectedColor);
 
@@ -106,19 +156,19 @@ void GameScene::init()
 		m_hudSystem->setCurrentLife(maxLife);
 	}
 
-	m_collisionSystem = std::make_unique<CollisionSystem>();
+	m_collisionSystem = m_arena.create<CollisionSystem>();
 
 	// 収集システムの初期化
-	m_coinSystem = std::make_unique<CoinSystem>();
+	m_coinSystem = m_arena.create<CoinSystem>();
 	m_coinSystem->init();
 	m_coinSystem->generateCoinsForStage(m_currentStageNumber);
 
-	m_starSystem = std::make_unique<StarSystem>();
+	m_starSystem = m_arena.create<StarSystem>();
 	m_starSystem->init();
 	m_starSystem->generateStarsForStage(m_currentStageNumber);
 
 	//BlockSystemの初期化
-	m_blockSystem = std::make_unique<BlockSystem>();
+	m_blockSystem = m_arena.create<BlockSystem>();
 	if (m_blockSystem) {
 		m_blockSystem->init();
 		m_blockSystem->generateBlocksForStage(m_currentStageNumber);
@@ -137,27 +187,135 @@ void GameScene::init()
 	// 敵の初期化
 	initEnemies();
 
-	m_shaderEffects = std::make_unique<ShaderEffects>();
-	m_shaderEffects->init();
-
 	// 昼夜システムの初期化
-	m_dayNightSystem = std::make_unique<DayNightSystem>();
+	m_dayNightSystem = m_arena.create<DayNightSystem>();
 	m_dayNightSystem->init();
 
 	// ゲーム状態の完全初期化
 	m_gameTime = 0.0;
+	SimulationClock::Reset();
+	m_sessionReplay.beginRecording(m_currentStageNumber, selectedColor, seed);
 	m_nextScene = none;
 	m_goalReached = false;
 	m_goalTimer = 0.0;
 
 	// 最終ステージかチェック
 	m_isLastStage = (m_currentStageNumber == StageNumber::Stage6);
+
+	// 前のシーン・ステージだけが使っていたテクスチャを解放（リトライ時は参照が戻るので再読み込みしない）
+	TextureCache::TrimUnused();
+}
+
+void GameScene::stepSimulation(const PlayerInput& input)
+{
+	if (m_player)
+	{
+		m_player->setInput(input);
+	}
+	runSimulationTick();
 }
 
 void GameScene::update()
+{
+	m_frameProfiler.beginUpdate(m_systemTimings);
+
+	if (KeyF3.down())
+	{
+		m_frameProfiler.toggleOverlay();
+	}
+
+	// 入力は描画フレームごとに1回だけ読む（押した瞬間の入力は次のティックまで保持される）
+	if (m_player)
+	{
+		m_player->setInput(PlayerInput::FromDevices());
+	}
+
+	// ゲームプレイは固定ティックで進める（描画フレームの長さに依存させない）
+	const int steps = SimulationClock::Advance(Scene::DeltaTime());
+	for (int i = 0; i < steps && m_nextScene == none; ++i)
+	{
+		runSimulationTick();
+	}
+
+	// 描画は直前の2ティックの間を補間する
+	if (m_stage)
+	{
+		m_stage->setInterpolationAlpha(SimulationClock::GetAlpha());
+	}
+
+#ifdef _DEBUG
+	// デバッグ用ステージ切り替え
+	if (Key1.down()) loadStage(StageNumber::Stage1);
+	if (Key2.down()) loadStage(StageNumber::Stage2);
+	if (Key3.down()) loadStage(StageNumber::Stage3);
+	if (Key4.down()) loadStage(StageNumber::Stage4);
+	if (Key5.down()) loadStage(StageNumber::Stage5);
+	if (Key6.down()) loadStage(StageNumber::Stage6);
+
+	// ステージを切り替えた場合はリプレイとして再現できないので記録を破棄
+	if (Key1.down() || Key2.down() || Key3.down() || Key4.down() || Key5.down() || Key6.down())
+	{
+		m_sessionReplay.clear();
+	}
+#endif
+
+	// ESCキーでタイトルに戻る（爆散中でない場合のみ）
+	if (KeyEscape.down() && (!m_player || !m_player->isExploding()))
+	{
+		m_nextScene = SceneType::Title;
+	}
+
+	// Rキーでキャラクター選択に戻る（爆散中でない場合のみ）
+	if (KeyR.down() && (!m_player || !m_player->isExploding()))
+	{
+		m_nextScene = SceneType::CharacterSelect;
+	}
+
+	m_frameProfiler.endUpdate(m_systemTimings);
+}
+
+void GameScene::runSimulationTick()
+{
+	// このティックで使う入力を記録
+	if (m_player)
+	{
+		m_sessionReplay.record(m_player->getInput());
+	}
+
+	SimulationClock::BeginTick();
+	savePreviousTickState();
+	updateSimulation();
+
+	// 倒された敵はティックの最後にまとめて破棄する（ティック中は EnemyBase* が有効なまま）
+	m_enemies.removeInactive();
+	SimulationClock::EndTick();
+}
+
+void GameScene::savePreviousTickState()
+{
+	if (m_player)
+	{
+		m_player->savePreviousTickPosition();
+	}
+
+	if (m_stage)
+	{
+		m_stage->savePreviousCameraOffset();
+	}
+
+	// 休眠中の敵は動かないので保存済みの位置のままでよい
+	m_enemies.forEach([](EnemyBase& enemy) {
+		if (!enemy.isSleeping())
+		{
+			enemy.savePreviousTickPosition();
+		}
+	});
+}
+
+void GameScene::updateSimulation()
 {
 	// ゲーム時間の更新
-	m_gameTime += Scene::DeltaTime();
+	m_gameTime += SimulationClock::DeltaTime();
 
 	// 既にシーン遷移が決定している場合は早期リターン
 	if (m_nextScene != none)
@@ -204,11 +362,13 @@ void GameScene::update()
 
 	if (m_shaderEffects)
 	{
-		m_shaderEffects->update(Scene::DeltaTime());
+		const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Effects };
+		m_shaderEffects->update(SimulationClock::DeltaTime());
 	}
 
 	if (m_dayNightSystem)
 	{
+		const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::DayNight };
 		m_dayNightSystem->update();
 	}
 	// ゴール判定（プレイヤー更新前にチェック）
@@ -222,37 +382,69 @@ void GameScene::update()
 	// ★ 緊急修正: プレイヤーの更新のみ実行（衝突判定は内部で処理）
 	if (m_player)
 	{
+		const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Player };
 		m_player->update();
 	}
 
 	if (!m_player || !m_player->isExploding())
 	{
 		// ★ 重要修正: 統一衝突判定システムを復活
-		updatePlayerCollisionsUnified();
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Collision };
+			updatePlayerCollisionsUnified();
+		}
 
 		// その他のシステム更新
-		updateBlockSystemInteractions();
-		updateCollectionSystems();
-		m_hudSystem->update();
-		updateHUDWithCollectedItems();
-		updateTotalCoinsFromBlocks();
-		updateEnemies();
-		updatePlayerEnemyCollision();
-		updateEnemyStageCollision();
-		updateFireballEnemyCollision();
-		updateFireballDestructionEffects();
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Blocks };
+			updateBlockSystemInteractions();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Collections };
+			updateCollectionSystems();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::HUD };
+			m_hudSystem->update();
+			updateHUDWithCollectedItems();
+			updateTotalCoinsFromBlocks();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Enemies };
+			updateEnemies();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::EnemyCollision };
+			updatePlayerEnemyCollision();
+			updateEnemyStageCollision();
+			updateFireballEnemyCollision();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Effects };
+			updateFireballDestructionEffects();
+		}
 	}
 	else
 	{
 		// 爆散中でも継続する更新
-		updateEnemies();
-		updateEnemyStageCollision();
-		updateFireballDestructionEffects();
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Enemies };
+			updateEnemies();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::EnemyCollision };
+			updateEnemyStageCollision();
+		}
+		{
+			const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Effects };
+			updateFireballDestructionEffects();
+		}
 	}
 
 	// ステージの更新（カメラ追従）
 	if (m_stage && m_player)
 	{
+		const ScopedSystemTimer timer{ m_systemTimings, SimulationSystem::Stage };
 		m_stage->update(m_player->getPosition());
 	}
 
@@ -269,29 +461,6 @@ void GameScene::update()
 	{
 		m_shaderEffects->enableChromatic(false);
 	}
-
-
-#ifdef _DEBUG
-	// デバッグ用ステージ切り替え
-	if (Key1.down()) loadStage(StageNumber::Stage1);
-	if (Key2.down()) loadStage(StageNumber::Stage2);
-	if (Key3.down()) loadStage(StageNumber::Stage3);
-	if (Key4.down()) loadStage(StageNumber::Stage4);
-	if (Key5.down()) loadStage(StageNumber::Stage5);
-	if (Key6.down()) loadStage(StageNumber::Stage6);
-#endif
-
-	// ESCキーでタイトルに戻る（爆散中でない場合のみ）
-	if (KeyEscape.down() && (!m_player || !m_player->isExploding()))
-	{
-		m_nextScene = SceneType::Title;
-	}
-
-	// Rキーでキャラクター選択に戻る（爆散中でない場合のみ）
-	if (KeyR.down() && (!m_player || !m_player->isExploding()))
-	{
-		m_nextScene = SceneType::CharacterSelect;
-	}
 }
 
 void GameScene::updateGoalCheck()
@@ -409,63 +578,76 @@ void GameScene::handleGoalReached()
 
 void GameScene::draw() const
 {
-	if (m_shaderEffects)
-	{
-		// RenderTextureへの描画開始
-		m_shaderEffects->beginCapture();
+	m_frameProfiler.beginDraw();
 
+	if (m_postProcess)
+	{
 		{
 			// ScopedRenderTarget2Dを使用してRenderTextureに描画
-			const ScopedRenderTarget2D target(m_shaderEffects->getRenderTarget());
+			const ScopedRenderTarget2D target(m_postProcess->beginCapture());
 
 			// === 既存の描画コードはそのまま ===
-			if (m_stage)
 			{
-				m_stage->draw();
-			}
-			else
-			{
-				Scene::Rect().draw(ColorF(0.2, 0.4, 0.6));
+				const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Stage };
+				if (m_stage)
+				{
+					m_stage->draw();
+				}
+				else
+				{
+					Scene::Rect().draw(ColorF(0.2, 0.4, 0.6));
+				}
 			}
 
 			if (m_stage)
 			{
-				const Vec2 cameraOffset = m_stage->getCameraOffset();
+				const Vec2 cameraOffset = m_stage->getRenderCameraOffset();
 
 				if (m_coinSystem)
 				{
+					const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Coins };
 					m_coinSystem->draw(cameraOffset);
 				}
 
 				if (m_starSystem)
 				{
+					const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Stars };
 					m_starSystem->draw(cameraOffset);
 				}
 
 				if (m_blockSystem)
 				{
+					const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Blocks };
 					m_blockSystem->draw(cameraOffset);
 				}
 			}
 
-			drawEnemies();
-
-			// 変身エフェクトを敵の後に描画（より前面に表示）
-			if (m_dayNightSystem && m_stage)
 			{
-				m_dayNightSystem->drawTransformEffects(m_stage->getCameraOffset());
+				const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Enemies };
+				drawEnemies();
 			}
-			drawFireballDestructionEffects();
 
-			if (m_player && m_stage)
 			{
-				drawPlayerFireballs();
+				const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Effects };
+
+				// 変身エフェクトを敵の後に描画（より前面に表示）
+				if (m_dayNightSystem && m_stage)
+				{
+					m_dayNightSystem->drawTransformEffects(m_stage->getRenderCameraOffset());
+				}
+				drawFireballDestructionEffects();
+
+				if (m_player && m_stage)
+				{
+					drawPlayerFireballs();
+				}
 			}
 
 			// プレイヤーの描画
 			if (m_player && m_stage)
 			{
-				const Vec2 playerWorldPos = m_player->getPosition();
+				const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::Player };
+				const Vec2 playerWorldPos = m_player->getInterpolatedPosition(SimulationClock::GetAlpha());
 				const Vec2 playerScreenPos = m_stage->worldToScreenPosition(playerWorldPos);
 
 				if (m_player->isExploding())
@@ -500,54 +682,50 @@ void GameScene::draw() const
 					}
 				}
 			}
+		}
 
-			if (m_hudSystem)
-			{
-				m_hudSystem->draw();
-			}
-
-			// ★ 新規追加: 昼夜システムのUI描画
-			drawDayNightUI();
+		// シェーダーエフェクトと昼夜の色調を適用して画面に描画
+		{
+			const ScopedDrawTimer timer{ m_frameProfiler, DrawPass::PostProcess };
+			m_postProcess->draw();
+		}
+		m_frameProfiler.setPostProcessStats(m_postProcess->getLastPassCount(), m_shaderEffects->getShockwaveCount());
 
-			// UI要素の描画
-			const String timeText = U"Time: {:.1f}s"_fmt(m_gameTime);
-			m_gameFont(timeText).draw(10, 10, ColorF(1.0, 1.0, 1.0));
+		// UI はポストエフェクトの対象外にして、その上に重ねる
+		const ScopedDrawTimer hudTimer{ m_frameProfiler, DrawPass::HUD };
 
-			if (m_player && !m_player->isExploding())
-			{
-				const String controlText = U"WASD: Move, SPACE: Jump, S: Duck, F: Fireball, ESC: Title, R: Character Select";
-				m_gameFont(controlText).draw(10, Scene::Height() - 40, ColorF(0.8, 0.8, 0.8));
-			}
-			else if (m_player && m_player->isExploding())
-			{
-				const String explosionText = U"GAME OVER...";
-				const Vec2 messagePos = Vec2(Scene::Center().x, Scene::Height() - 100);
-				const double alpha = 0.7 + 0.3 * std::sin(Scene::Time() * 4.0);
-				Font(32, Typeface::Bold)(explosionText).drawAt(messagePos, ColorF(1.0, 0.3, 0.3, alpha));
-			}
+		if (m_hudSystem)
+		{
+			m_hudSystem->draw();
 		}
 
-		// シェーダーエフェクトを適用して画面に描画
-		m_shaderEffects->endCaptureAndDraw();
+		drawUILayer();
 
-		if (m_dayNightSystem)
+		// ★ 新規追加: 昼夜システムのUI描画
+		drawDayNightUI();
+
+		// UI要素の描画
+		const int64 timeTenths = static_cast<int64>(std::llround(m_gameTime * 10.0));
+		m_timeText.clear().append(U"Time: ").append(timeTenths / 10).append(U".").append(timeTenths % 10).append(U"s");
+		m_timeText.draw(Vec2(10, 10), ColorF(1.0, 1.0, 1.0));
+
+		if (m_player && !m_player->isExploding())
 		{
-			RenderTexture tempTexture(Scene::Size());
-			{
-				const ScopedRenderTarget2D target2(tempTexture);
-				Scene::Rect().draw(ColorF(0.0, 0.0, 0.0, 0.0));
-				m_shaderEffects->getRenderTarget().draw();
-			}
-			m_dayNightSystem->applyShader(tempTexture);
+			m_controlText.get().draw(10, Scene::Height() - 40, ColorF(0.8, 0.8, 0.8));
+		}
+		else if (m_player && m_player->isExploding())
+		{
+			const Vec2 messagePos = Vec2(Scene::Center().x, Scene::Height() - 100);
+			const double alpha = 0.7 + 0.3 * std::sin(Scene::Time() * 4.0);
+			m_gameOverText.get().drawAt(messagePos, ColorF(1.0, 0.3, 0.3, alpha));
 		}
 	}
 	else if (m_player && m_player->isExploding())
 	{
 		// 爆散中は特別なメッセージ
-		const String explosionText = U"GAME OVER...";
 		const Vec2 messagePos = Vec2(Scene::Center().x, Scene::Height() - 100);
 		const double alpha = 0.7 + 0.3 * std::sin(Scene::Time() * 4.0);
-		Font(32, Typeface::Bold)(explosionText).drawAt(messagePos, ColorF(1.0, 0.3, 0.3, alpha));
+		m_gameOverText.get().drawAt(messagePos, ColorF(1.0, 0.3, 0.3, alpha));
 	}
 
 	// ★ 削除: 古い時間表示コード（drawDayNightUI()に統合）
@@ -587,9 +765,26 @@ void GameScene::draw() const
 			m_gameFont(cameraInfo).draw(10, 130, ColorF(1.0, 0.8, 0.8));
 		}
 
-		const String enemyInfo = U"Enemies: {}"_fmt(m_enemies.size());
+		const String enemyInfo = U"Enemies: {} ({} awake) | Textures: {} cached / {} loads"_fmt(
+			m_enemies.size(),
+			m_awakeEnemyCount,
+			TextureCache::GetCachedCount(),
+			TextureCache::GetLoadCount()
+		);
 		m_gameFont(enemyInfo).draw(10, 160, ColorF(0.8, 1.0, 0.8));
 
+		// ブロードフェーズの統計（直前のフレーム）
+		if (m_broadphase)
+		{
+			const auto& stats = m_broadphase->getStats();
+			const String broadphaseInfo = U"Broadphase: {} tests / {} brute force ({} avoided)"_fmt(
+				stats.pairTests,
+				stats.bruteForcePairs,
+				stats.getAvoidedTests()
+			);
+			m_gameFont(broadphaseInfo).draw(10, 340, ColorF(1.0, 0.9, 0.6));
+		}
+
 		// BlockSystemのデバッグ情報
 		if (m_blockSystem)
 		{
@@ -615,10 +810,11 @@ void GameScene::draw() const
 
 		if (m_hudSystem)
 		{
-			const String hudInfo = U"HUD Stars: {} / {} | Life: {}"_fmt(
+			const String hudInfo = U"HUD Stars: {} / {} | Life: {} | Redrawn regions: {}"_fmt(
 				m_hudSystem->getCollectedStars(),
 				m_hudSystem->getTotalStars(),
-				m_hudSystem->getCurrentLife()
+				m_hudSystem->getCurrentLife(),
+				m_hudSystem->getLastRedrawnRegionCount()
 			);
 			m_gameFont(hudInfo).draw(10, 220, ColorF(1.0, 0.8, 0.8));
 		}
@@ -646,13 +842,17 @@ void GameScene::draw() const
 		m_gameFont(stageInfo).draw(10, 310, ColorF(0.8, 1.0, 0.8));
 	}
 #endif
+
+	// オーバーレイ自体の描画は計測に含めない
+	m_frameProfiler.endDraw();
+	m_frameProfiler.drawOverlay(m_profilerFont);
 }
 
 void GameScene::drawPlayerFireballs() const
 {
 	if (!m_player || !m_stage) return;
 
-	const Vec2 cameraOffset = m_stage->getCameraOffset();
+	const Vec2 cameraOffset = m_stage->getRenderCameraOffset();
 	const auto& fireballs = m_player->getFireballs();
 
 	for (const auto& fireball : fireballs)
@@ -690,7 +890,7 @@ void GameScene::drawPlayerFireballs() const
 #ifdef _DEBUG
 			// デバッグ情報
 			const String fireballDebug = U"FB: ({:.0f}, {:.0f})"_fmt(fireball.position.x, fireball.position.y);
-			Font(12)(fireballDebug).draw(fireballScreenPos + Vec2(30, -20), ColorF(1.0, 1.0, 0.0));
+			FontRegistry::Get(12)(fireballDebug).draw(fireballScreenPos + Vec2(30, -20), ColorF(1.0, 1.0, 0.0));
 #endif
 		}
 	}
@@ -727,33 +927,6 @@ void GameScene::drawFireballDestructionEffects() const
 				}
 			}
 
-			// パーティクル描画
-			for (const auto& particle : effect.particles)
-			{
-				const Vec2 particleScreenPos = m_stage->worldToScreenPosition(particle.position);
-				const double alpha = particle.life / particle.maxLife;
-				const ColorF color = ColorF(particle.color.r, particle.color.g, particle.color.b, alpha);
-
-				// メインパーティクル
-				Circle(particleScreenPos, particle.size).draw(color);
-
-				// 光る効果
-				Circle(particleScreenPos, particle.size * 1.5).draw(
-					ColorF(1.0, 0.8, 0.4, alpha * 0.3));
-
-				// 火花効果
-				if (particle.size > 2.0)
-				{
-					const double sparkSize = particle.size * 0.3;
-					Line(particleScreenPos.x - sparkSize, particleScreenPos.y,
-						 particleScreenPos.x + sparkSize, particleScreenPos.y)
-						.draw(1.0, ColorF(1.0, 1.0, 0.8, alpha));
-					Line(particleScreenPos.x, particleScreenPos.y - sparkSize,
-						 particleScreenPos.x, particleScreenPos.y + sparkSize)
-						.draw(1.0, ColorF(1.0, 1.0, 0.8, alpha));
-				}
-			}
-
 			// 中央の爆発フラッシュ
 			if (effect.timer <= 0.3)
 			{
@@ -766,6 +939,37 @@ void GameScene::drawFireballDestructionEffects() const
 			}
 		}
 	}
+
+	// パーティクル描画
+	for (size_t i = 0; i < m_fireballParticles.size(); ++i)
+	{
+		const Vec2 particleScreenPos = m_stage->worldToScreenPosition(m_fireballParticles.getPosition(i));
+		if (particleScreenPos.x < -100 || particleScreenPos.x > Scene::Width() + 100) continue;
+
+		const double alpha = m_fireballParticles.getLifeRatio(i);
+		const double size = m_fireballParticles.getSize(i);
+		const ColorF& baseColor = m_fireballParticles.getColor(i);
+		const ColorF color = ColorF(baseColor.r, baseColor.g, baseColor.b, alpha);
+
+		// メインパーティクル
+		Circle(particleScreenPos, size).draw(color);
+
+		// 光る効果
+		Circle(particleScreenPos, size * 1.5).draw(
+			ColorF(1.0, 0.8, 0.4, alpha * 0.3));
+
+		// 火花効果
+		if (size > 2.0)
+		{
+			const double sparkSize = size * 0.3;
+			Line(particleScreenPos.x - sparkSize, particleScreenPos.y,
+				 particleScreenPos.x + sparkSize, particleScreenPos.y)
+				.draw(1.0, ColorF(1.0, 1.0, 0.8, alpha));
+			Line(particleScreenPos.x, particleScreenPos.y - sparkSize,
+				 particleScreenPos.x, particleScreenPos.y + sparkSize)
+				.draw(1.0, ColorF(1.0, 1.0, 0.8, alpha));
+		}
+	}
 }
 
 Optional<SceneType> GameScene::getNextScene() const
@@ -777,14 +981,31 @@ void GameScene::cleanup()
 {
 	SoundManager::GetInstance().stopBGM();
 
+	// 直前のプレイをリプレイとして保存（処理落ちの調査やベンチマークの再現用）
+	if (m_saveSessionReplay && m_player && m_sessionReplay.getTickCount() > 0)
+	{
+		m_sessionReplay.setFinalPlayerPosition(m_player->getPosition());
+		if (!m_sessionReplay.save(SESSION_REPLAY_PATH))
+		{
+			Print << U"Failed to save replay: " << SESSION_REPLAY_PATH;
+		}
+	}
+
 	m_player.reset();
 	m_stage.reset();
 	m_enemies.clear();
+	m_broadphaseEnemies.clear();
+	m_enemySpawns = nullptr;
+	m_enemySpawnSlots.clear();
+	m_spawnedEnemyEntries.clear();
+	m_despawnedEnemyEntries.clear();
 	m_hudSystem.reset();
 	m_coinSystem.reset();
 	m_starSystem.reset();
 	m_blockSystem.reset();
 	m_collisionSystem.reset();
+	m_broadphase.reset();
+	m_chaseField.reset();
 }
 
 void GameScene::loadStage(StageNumber stageNumber)
@@ -792,6 +1013,12 @@ void GameScene::loadStage(StageNumber stageNumber)
 	m_currentStageNumber = stageNumber;
 	m_stage = std::make_unique<Stage>(stageNumber);
 
+	// ブロードフェーズのグリッドをステージの大きさに合わせる
+	if (m_broadphase)
+	{
+		m_broadphase->setWorldBounds(m_stage->getTileGridBounds());
+	}
+
 	// プレイヤーの位置をステージの安全な場所にリセット
 	if (m_player)
 	{
@@ -800,6 +1027,7 @@ void GameScene::loadStage(StageNumber stageNumber)
 		Vec2 safePosition = Vec2(3.0 * BLOCK_SIZE, 12.5 * BLOCK_SIZE);
 
 		m_player->setPosition(safePosition);
+		m_player->savePreviousTickPosition();  // 移動元から補間しない
 		m_player->setVelocity(Vec2::Zero());
 		m_player->resetFireballCount();
 	}
@@ -834,36 +1062,107 @@ void GameScene::loadStage(StageNumber stageNumber)
 void GameScene::initEnemies()
 {
 	m_enemies.clear();
+	m_spawnedEnemyEntries.clear();
+	m_despawnedEnemyEntries.clear();
 
-	String stageFile;
-	stageFile = U"Stages/Stage{}.json"_fmt(static_cast<int>(m_currentStageNumber));
-	
+	// 出現リストはステージごとに1回だけ読み込む。ここでは敵を生成せず、カメラが近づいた時に updateEnemySpawns() で生成する
+	m_enemySpawns = &EnemySpawnTable::Get(m_currentStageNumber);
+	m_enemySpawnSlots.assign(m_enemySpawns->size(), EnemySpawnSlot{});
+	m_spawnedEnemyEntries.reserve(m_enemySpawns->size());
+	m_despawnedEnemyEntries.reserve(m_enemySpawns->size());
 
-	if (!FileSystem::Exists(stageFile)) {
-#ifdef _DEBUG
-		Print << U"Not find Stage file: " << stageFile;
-#endif
-		return;
+	// 出現リストの敵を一度ずつ生成して破棄しておく。種類ごとの画像の読み込みと、
+	// プールのチャンク・空きスロットの確保をここで済ませ、プレイ中の出現ではメモリを確保しない
+	for (const EnemySpawn& spawn : *m_enemySpawns)
+	{
+		try {
+			addEnemy(spawn.type, spawn.position);
+		}
+		catch (const std::exception&) {
+			// 生成できない敵は updateEnemySpawns() で報告する
+		}
 	}
+	m_enemies.forEach([](auto& enemy) { enemy.setActive(false); });
+	m_enemies.removeInactive();
+	m_enemies.clear();
+}
 
-	const JSON stageData = JSON::Load(stageFile);
-	if (!stageData) {
-#ifdef _DEBUG
-		Print << U"Failed to load json: " << stageFile;
-#endif
-		return;
+double GameScene::computeEnemyViewLeft() const
+{
+	return m_stage->computeCameraX(m_player->getPosition().x, ENEMY_ACTIVATION_VIEW_WIDTH);
+}
+
+void GameScene::updateEnemySpawns()
+{
+	if (!m_enemySpawns || !m_stage || !m_player) return;
+
+	const double viewLeft = computeEnemyViewLeft();
+	const double viewRight = viewLeft + ENEMY_ACTIVATION_VIEW_WIDTH;
+
+	// 倒された敵は二度と出さず、遠く後ろへ離れた敵は無効にする（プールからの破棄はティックの最後の removeInactive() に任せる）
+	for (size_t i = 0; i < m_spawnedEnemyEntries.size();)
+	{
+		const uint32 entry = m_spawnedEnemyEntries[i];
+		EnemySpawnSlot& slot = m_enemySpawnSlots[entry];
+		EnemyBase* enemy = m_enemies.get(slot.handle);
+
+		if (enemy && (viewLeft - ENEMY_DESPAWN_MARGIN) <= enemy->getPosition().x)
+		{
+			++i;
+			continue;
+		}
+
+		if (enemy)
+		{
+			enemy->setActive(false);
+			slot.state = EnemySpawnState::Despawned;
+			m_despawnedEnemyEntries.push_back(entry);
+		}
+		else
+		{
+			slot.state = EnemySpawnState::Finished;
+		}
+
+		m_spawnedEnemyEntries[i] = m_spawnedEnemyEntries.back();
+		m_spawnedEnemyEntries.pop_back();
+	}
+
+	// 破棄した敵は出現位置も起こす範囲の外に出てから出現前に戻す（同じティックでその場に出し直さない）
+	for (size_t i = 0; i < m_despawnedEnemyEntries.size();)
+	{
+		const uint32 entry = m_despawnedEnemyEntries[i];
+		const double spawnX = (*m_enemySpawns)[entry].position.x;
+
+		if (((viewLeft - ENEMY_WAKE_MARGIN) <= spawnX) && (spawnX <= (viewRight + ENEMY_WAKE_MARGIN)))
+		{
+			++i;
+			continue;
+		}
+
+		m_enemySpawnSlots[entry].state = EnemySpawnState::Pending;
+		m_despawnedEnemyEntries[i] = m_despawnedEnemyEntries.back();
+		m_despawnedEnemyEntries.pop_back();
 	}
 
-	for (const auto& enemyEntry : stageData.arrayView()) {
-		String type = enemyEntry[U"type"].getString();
-		double x = enemyEntry[U"x"].get<double>();
-		double y = enemyEntry[U"y"].get<double>();
+	// 出現位置が画面に近づいた敵を生成する（出現リストは x 順なので範囲は二分探索で求まる）
+	const auto [first, last] = EnemySpawnTable::FindRange(*m_enemySpawns,
+		(viewLeft - ENEMY_WAKE_MARGIN), (viewRight + ENEMY_WAKE_MARGIN));
+
+	for (size_t i = first; i < last; ++i)
+	{
+		EnemySpawnSlot& slot = m_enemySpawnSlots[i];
+		if (slot.state != EnemySpawnState::Pending) continue;
+
+		const EnemySpawn& spawn = (*m_enemySpawns)[i];
 
 		try {
-			addEnemy(spawnEnemy(type, Vec2{ x,y }));
+			slot.handle = addEnemy(spawn.type, spawn.position);
+			slot.state = EnemySpawnState::Spawned;
+			m_spawnedEnemyEntries.push_back(static_cast<uint32>(i));
 		}
 		catch (const std::exception& e) {
 			Print << U"Failed to generate enemy: " << Unicode::FromUTF8(e.what());
+			slot.state = EnemySpawnState::Finished;
 		}
 	}
 }
@@ -871,56 +1170,50 @@ void GameScene::initEnemies()
 
 void GameScene::updateEnemies()
 {
+	// カメラに近づいた敵を生成し、カメラから遠い敵は休眠させて以降の更新・衝突判定から外す
+	updateEnemySpawns();
+	updateEnemyActivation();
+
+	// 追跡する敵はここで作った距離場を参照する
+	updateChaseField();
+
+	// 敵は種類ごとのプールに入っているので、以下のラムダは種類ごとの型で展開される
+	// （各敵クラスは final なので update() なども静的に呼ばれる）
 	if (!m_dayNightSystem)
 	{
 		// 昼夜システムがない場合は通常更新
-		for (auto& enemy : m_enemies)
-		{
-			if (enemy && enemy->isActive())
+		m_enemies.forEach([&](auto& enemy) {
+			if (enemy.isActive() && !enemy.isSleeping())
 			{
-				enemy->update();
-				enemy->updateBlackFireAnimation(); // 黒い炎アニメーション更新
+				enemy.update();
+				enemy.updateBlackFireAnimation(); // 黒い炎アニメーション更新
 			}
-		}
+		});
 	}
 	else
 	{
 		// 夜になった瞬間の変身処理
 		if (m_dayNightSystem->justBecameNight())
 		{
-			// すべての敵を変身させる
-			for (auto& enemy : m_enemies)
-			{
-				if (!enemy || !enemy->isActive()) continue;
-
-				// 変身対象の敵タイプのみ変身
-				bool shouldTransform = false;
-				switch (enemy->getType())
+			// 変身対象の敵をすべて変身させる
+			m_enemies.forEach([&](auto& enemy) {
+				using Enemy = std::decay_t<decltype(enemy)>;
+				if constexpr (Enemy::TRANSFORMS_AT_NIGHT)
 				{
-				case EnemyType::NormalSlime:
-				case EnemyType::SpikeSlime:
-				case EnemyType::Bee:
-				case EnemyType::Fly:
-					shouldTransform = true;
-					break;
-				default:
-					break;
-				}
+					if (!enemy.isActive()) return;
 
-				if (shouldTransform)
-				{
 					// 敵を変身状態にする
-					enemy->transform();
+					enemy.transform();
 
 					// 変身時の速度・挙動変更
-					Vec2 velocity = enemy->getVelocity();
+					Vec2 velocity = enemy.getVelocity();
 					velocity.x *= 1.5; // 速度1.5倍
-					enemy->setVelocity(velocity);
+					enemy.setVelocity(velocity);
 
 					// サウンドエフェクト再生
 					SoundManager::GetInstance().playSE(SoundManager::SoundType::SFX_BREAK_BLOCK);
 				}
-			}
+			});
 
 			// フラグをリセット
 			m_dayNightSystem->resetNightTransition();
@@ -929,168 +1222,255 @@ void GameScene::updateEnemies()
 		// 昼に戻った時の変身解除
 		if (!m_dayNightSystem->isNight() && !m_dayNightSystem->isDangerous())
 		{
-			for (auto& enemy : m_enemies)
-			{
-				if (enemy && enemy->isTransformed())
+			m_enemies.forEach([&](auto& enemy) {
+				if (enemy.isTransformed())
 				{
-					enemy->untransform();
+					enemy.untransform();
 
 					// 速度を通常に戻す
-					Vec2 velocity = enemy->getVelocity();
+					Vec2 velocity = enemy.getVelocity();
 					velocity.x /= 1.5;
-					enemy->setVelocity(velocity);
+					enemy.setVelocity(velocity);
 				}
-			}
+			});
 		}
 
-		// 変身中の敵の特殊挙動
-		const double speedMultiplier = m_dayNightSystem->getEnemySpeedMultiplier();
-		const double aggressionMultiplier = m_dayNightSystem->getEnemyAggressionMultiplier();
-		const bool isNightTime = m_dayNightSystem->isNight();
-		const bool isDangerousTime = m_dayNightSystem->isDangerous();
-
-		for (auto& enemy : m_enemies)
-		{
-			if (!enemy || !enemy->isActive()) continue;
+		m_enemies.forEach([&](auto& enemy) {
+			if (!enemy.isActive() || enemy.isSleeping()) return;
 
 			// 黒い炎アニメーション更新
-			enemy->updateBlackFireAnimation();
+			enemy.updateBlackFireAnimation();
 
-			// 変身中の特殊挙動
-			if (enemy->isTransformed())
+			// 変身中の特殊挙動（種類ごとのオーバーロードを呼び分ける）
+			if (enemy.isTransformed())
 			{
-				switch (enemy->getType())
-				{
-				case EnemyType::NormalSlime:
-				{
-					NormalSlime* slime = static_cast<NormalSlime*>(enemy.get());
-					Vec2 velocity = slime->getVelocity();
+				updateNightBehavior(enemy);
+			}
 
-					// 変身中は常に高速移動
-					if (std::abs(velocity.x) > 0)
-					{
-						velocity.x = (velocity.x > 0 ? 1 : -1) * 100.0;
-					}
+			// 共通の更新処理
+			enemy.update();
+		});
+	}
 
-					// 時々大ジャンプ
-					if (slime->isGrounded() && Random(0.0, 1.0) < 0.02)
-					{
-						velocity.y = -400.0;
-					}
+	// 移動後の位置でブロードフェーズに登録し直す
+	rebuildEnemyBroadphase();
+}
 
-					slime->setVelocity(velocity);
-				}
-				break;
+void GameScene::updateChaseField()
+{
+	if (!m_chaseField || !m_stage || !m_player) return;
 
-				case EnemyType::SpikeSlime:
-				{
-					SpikeSlime* spike = static_cast<SpikeSlime*>(enemy.get());
-					if (m_player)
-					{
-						const Vec2 playerPos = m_player->getPosition();
-						const Vec2 enemyPos = spike->getPosition();
-						const double distance = playerPos.distanceFrom(enemyPos);
+	// 距離場を使うのは変身中の敵（夜・夕方）と、プレイヤーに触れている Bee だけ。どちらもいなければ探索しない
+	if (!(m_dayNightSystem && m_dayNightSystem->isDangerous()) && !isBeeTouchingPlayer())
+	{
+		m_chaseField->invalidate();
+		return;
+	}
 
-						// 変身中は追跡範囲拡大
-						if (distance < 500.0)
-						{
-							const bool shouldGoLeft = playerPos.x < enemyPos.x;
-							const EnemyDirection targetDir = shouldGoLeft ?
-								EnemyDirection::Left : EnemyDirection::Right;
-
-							if (spike->getDirection() != targetDir)
-							{
-								spike->changeDirection();
-							}
-
-							Vec2 velocity = spike->getVelocity();
-							velocity.x = (shouldGoLeft ? -1 : 1) * 120.0;
-							spike->setVelocity(velocity);
-						}
-					}
-				}
-				break;
+	// 起きている敵がいる範囲（眠らせる距離まで）の列だけを探索する
+	const double viewLeft = computeEnemyViewLeft();
+	const double blockSize = m_stage->getBlockSize();
+	const int minColumn = static_cast<int>(Math::Floor((viewLeft - ENEMY_SLEEP_MARGIN) / blockSize));
+	const int maxColumn = static_cast<int>(Math::Floor((viewLeft + ENEMY_ACTIVATION_VIEW_WIDTH + ENEMY_SLEEP_MARGIN) / blockSize));
 
-				case EnemyType::Bee:
-				{
-					Bee* bee = static_cast<Bee*>(enemy.get());
-					if (m_player)
-					{
-						// 変身中は超積極的に追跡
-						const double chaseRange = 600.0;
-						const Vec2 playerPos = m_player->getPosition();
-						const double distance = bee->getPosition().distanceFrom(playerPos);
+	m_chaseField->build(*m_stage, m_player->getPosition(), minColumn, maxColumn);
+}
 
-						if (distance < chaseRange)
-						{
-							bee->updateChase(playerPos);
-							Vec2 velocity = bee->getVelocity();
-							velocity *= 2.0; // 倍速
-							bee->setVelocity(velocity);
-						}
-					}
-				}
-				break;
+bool GameScene::isBeeTouchingPlayer()
+{
+	if (!m_broadphase) return false;
+
+	// ブロードフェーズは前のティックの移動後の位置なので、このティックの移動の分（1ブロック）広げて判定する
+	const Vec2 playerPos = m_player->getPosition();
+	const double BLOCK_SIZE = 64.0;
+	const RectF contactRect(
+		playerPos.x - BLOCK_SIZE * 1.5,
+		playerPos.y - BLOCK_SIZE * 1.5,
+		BLOCK_SIZE * 3,
+		BLOCK_SIZE * 3
+	);
+
+	m_broadphase->queryEnemies(contactRect, m_broadphaseCandidates);
 
-				case EnemyType::Fly:
+	bool touching = false;
+	for (const size_t enemyIndex : m_broadphaseCandidates)
+	{
+		m_enemies.visit(m_broadphaseEnemies[enemyIndex], [&](auto& enemy) {
+			if constexpr (std::is_same_v<std::decay_t<decltype(enemy)>, Bee>)
+			{
+				if (enemy.isActive() && enemy.isAlive() && contactRect.intersects(enemy.getCollisionRect()))
 				{
-					Fly* fly = static_cast<Fly*>(enemy.get());
-					if (m_player)
-					{
-						const Vec2 playerPos = m_player->getPosition();
-						const Vec2 flyPos = fly->getPosition();
+					touching = true;
+				}
+			}
+		});
 
-						// 変身中は直接プレイヤーを追跡
-						const Vec2 direction = (playerPos - flyPos).normalized();
-						Vec2 velocity = direction * 150.0;
+		if (touching) return true;
+	}
 
-						// ジグザグ動作を追加
-						velocity.x += std::sin(Scene::Time() * 10.0) * 50.0;
-						velocity.y += std::cos(Scene::Time() * 10.0) * 30.0;
+	return false;
+}
 
-						fly->setVelocity(velocity);
-					}
-				}
-				break;
+ChaseFieldSystem::Sample GameScene::sampleChaseTarget(const Vec2& position) const
+{
+	if (m_chaseField)
+	{
+		if (const auto sample = m_chaseField->sample(position))
+		{
+			return *sample;
+		}
+	}
 
-				default:
-					break;
-				}
-			}
+	// 距離場の外・到達できない場所ではプレイヤーへ直進する
+	const Vec2 playerPos = m_player->getPosition();
+	return ChaseFieldSystem::Sample{ playerPos, position.distanceFrom(playerPos) };
+}
 
-			// 共通の更新処理
-			enemy->update();
+void GameScene::updateNightBehavior(NormalSlime& slime)
+{
+	Vec2 velocity = slime.getVelocity();
+
+	// 変身中は常に高速移動
+	if (std::abs(velocity.x) > 0)
+	{
+		velocity.x = (velocity.x > 0 ? 1 : -1) * 100.0;
+	}
+
+	// 時々大ジャンプ
+	if (slime.isGrounded() && GameRandom::Range(0.0, 1.0) < 0.02)
+	{
+		velocity.y = -400.0;
+	}
+
+	slime.setVelocity(velocity);
+}
+
+void GameScene::updateNightBehavior(SpikeSlime& spike)
+{
+	if (!m_player) return;
+
+	const Vec2 enemyPos = spike.getPosition();
+	const ChaseFieldSystem::Sample chase = sampleChaseTarget(enemyPos);
+
+	// 変身中は追跡範囲拡大（地形を回り込む経路の長さで判定）
+	if (chase.pathDistance < 500.0)
+	{
+		const bool shouldGoLeft = chase.waypoint.x < enemyPos.x;
+		const EnemyDirection targetDir = shouldGoLeft ?
+			EnemyDirection::Left : EnemyDirection::Right;
+
+		if (spike.getDirection() != targetDir)
+		{
+			spike.changeDirection();
 		}
+
+		Vec2 velocity = spike.getVelocity();
+		velocity.x = (shouldGoLeft ? -1 : 1) * 120.0;
+		spike.setVelocity(velocity);
 	}
+}
 
-	// 非アクティブな敵を削除
-	m_enemies.erase(
-		std::remove_if(m_enemies.begin(), m_enemies.end(),
-			[](const std::unique_ptr<EnemyBase>& enemy) {
-				return !enemy || !enemy->isActive();
-			}),
-		m_enemies.end()
-	);
+void GameScene::updateNightBehavior(Bee& bee)
+{
+	if (!m_player) return;
+
+	// 変身中は超積極的に追跡
+	const double chaseRange = 600.0;
+	const ChaseFieldSystem::Sample chase = sampleChaseTarget(bee.getPosition());
+
+	if (chase.pathDistance < chaseRange)
+	{
+		bee.updateChase(chase.waypoint, chase.pathDistance);
+		Vec2 velocity = bee.getVelocity();
+		velocity *= 2.0; // 倍速
+		bee.setVelocity(velocity);
+	}
+}
+
+void GameScene::updateNightBehavior(Fly& fly)
+{
+	if (!m_player) return;
+
+	const Vec2 flyPos = fly.getPosition();
+
+	// 変身中は地形を回り込みながらプレイヤーを追跡
+	const Vec2 direction = (sampleChaseTarget(flyPos).waypoint - flyPos).normalized();
+	Vec2 velocity = direction * 150.0;
+
+	// ジグザグ動作を追加
+	velocity.x += std::sin(SimulationClock::Time() * 10.0) * 50.0;
+	velocity.y += std::cos(SimulationClock::Time() * 10.0) * 30.0;
+
+	fly.setVelocity(velocity);
+}
+
+void GameScene::updateEnemyActivation()
+{
+	m_awakeEnemyCount = 0;
+	if (!m_stage || !m_player) return;
+
+	// 起こす範囲より眠らせる範囲を広く取り、境界付近で状態が行き来しないようにする
+	const double viewLeft = computeEnemyViewLeft();
+	const double viewRight = viewLeft + ENEMY_ACTIVATION_VIEW_WIDTH;
+
+	m_enemies.forEach([&](EnemyBase& enemy) {
+		const double x = enemy.getPosition().x;
+		if (enemy.isSleeping())
+		{
+			if ((viewLeft - ENEMY_WAKE_MARGIN) <= x && x <= (viewRight + ENEMY_WAKE_MARGIN))
+			{
+				enemy.setSleeping(false);
+			}
+		}
+		else if (x < (viewLeft - ENEMY_SLEEP_MARGIN) || (viewRight + ENEMY_SLEEP_MARGIN) < x)
+		{
+			enemy.setSleeping(true);
+		}
+
+		if (!enemy.isSleeping())
+		{
+			++m_awakeEnemyCount;
+		}
+	});
+}
+
+void GameScene::rebuildEnemyBroadphase()
+{
+	if (!m_broadphase) return;
+
+	m_broadphase->beginFrame();
+
+	// ブロードフェーズの番号 → 敵のハンドル
+	m_broadphaseEnemies.clear();
+
+	m_enemies.forEach([&](const EnemyBase& enemy) {
+		if (enemy.isActive() && enemy.isAlive() && !enemy.isSleeping())
+		{
+			m_broadphase->insertEnemy(m_broadphaseEnemies.size(), enemy.getCollisionRect());
+			m_broadphaseEnemies.push_back(enemy.getHandle());
+		}
+	});
 }
 
 void GameScene::drawEnemies() const
 {
 	if (!m_stage) return;
 
-	for (const auto& enemy : m_enemies)
-	{
-		if (enemy->isActive() || enemy->getState() == EnemyState::Flattened)
+	const double alpha = SimulationClock::GetAlpha();
+
+	m_enemies.forEach([&](const EnemyBase& enemy) {
+		if (enemy.isActive() || enemy.getState() == EnemyState::Flattened)
 		{
-			const Vec2 enemyWorldPos = enemy->getPosition();
+			const Vec2 enemyWorldPos = enemy.getInterpolatedPosition(alpha);
 			const Vec2 enemyScreenPos = m_stage->worldToScreenPosition(enemyWorldPos);
 
 			if (enemyScreenPos.x >= -100 && enemyScreenPos.x <= Scene::Width() + 100)
 			{
 				// 変身状態なら黒い炎を描画
-				if (enemy->isTransformed() && m_blackFireTexture)
+				if (enemy.isTransformed() && m_blackFireTexture)
 				{
 					// 現在のフレームを取得
-					const int frame = enemy->getBlackFireFrame();
+					const int frame = enemy.getBlackFireFrame();
 					const int row = frame / 4;
 					const int col = frame % 4;
 
@@ -1106,7 +1486,7 @@ void GameScene::drawEnemies() const
 					const double scale = BLACKFIRE_DRAW_SIZE / BLACKFIRE_SPRITE_SIZE;
 
 					// 敵の向きに応じて反転
-					if (enemy->getDirection() == EnemyDirection::Left)
+					if (enemy.getDirection() == EnemyDirection::Left)
 					{
 						m_blackFireTexture(srcRect)
 							.scaled(scale)
@@ -1130,7 +1510,7 @@ void GameScene::drawEnemies() const
 					ColorF tint = ColorF(1.0, 1.0, 1.0);
 
 					// 昼夜による色調整（非変身時のみ）
-					if (m_dayNightSystem && !enemy->isTransformed())
+					if (m_dayNightSystem && !enemy.isTransformed())
 					{
 						if (m_dayNightSystem->isNight())
 						{
@@ -1142,10 +1522,10 @@ void GameScene::drawEnemies() const
 						}
 					}
 
-					const Texture currentTexture = enemy->getCurrentTexture();
+					const Texture currentTexture = enemy.getCurrentTexture();
 					if (currentTexture)
 					{
-						if (enemy->getDirection() == EnemyDirection::Left)
+						if (enemy.getDirection() == EnemyDirection::Left)
 						{
 							currentTexture.mirrored().drawAt(enemyScreenPos, tint);
 						}
@@ -1158,7 +1538,7 @@ void GameScene::drawEnemies() const
 					{
 						// フォールバック描画
 						ColorF fallbackColor;
-						switch (enemy->getType())
+						switch (enemy.getType())
 						{
 						case EnemyType::NormalSlime:  fallbackColor = ColorF(0.2, 0.8, 0.2); break;
 						case EnemyType::SpikeSlime:   fallbackColor = ColorF(0.6, 0.2, 0.6); break;
@@ -1174,17 +1554,17 @@ void GameScene::drawEnemies() const
 				}
 
 				// 状態エフェクト描画
-				if (enemy->getState() == EnemyState::Flattened)
+				if (enemy.getState() == EnemyState::Flattened)
 				{
-					drawEnemyFlattenedEffect(enemyScreenPos, enemy.get());
+					drawEnemyFlattenedEffect(enemyScreenPos, &enemy);
 				}
-				else if (enemy->getState() == EnemyState::Hit)
+				else if (enemy.getState() == EnemyState::Hit)
 				{
-					drawEnemyHitEffect(enemyScreenPos, enemy.get());
+					drawEnemyHitEffect(enemyScreenPos, &enemy);
 				}
 			}
 		}
-	}
+	});
 }
 
 void GameScene::drawEnemyFlattenedEffect(const Vec2& screenPos, const EnemyBase* enemy) const
@@ -1226,7 +1606,7 @@ void GameScene::drawEnemyHitEffect(const Vec2& screenPos, const EnemyBase* enemy
 
 void GameScene::updatePlayerEnemyCollision()
 {
-	if (!m_player || !m_stage) return;
+	if (!m_player || !m_stage || !m_broadphase) return;
 
 	const Vec2 playerPos = m_player->getPosition();
 	const double BLOCK_SIZE = 64.0;
@@ -1239,49 +1619,36 @@ void GameScene::updatePlayerEnemyCollision()
 		BLOCK_SIZE
 	);
 
-	for (auto& enemy : m_enemies)
+	// 近くの敵だけを候補として判定
+	m_broadphase->queryEnemies(playerRect, m_broadphaseCandidates);
+
+	for (const size_t enemyIndex : m_broadphaseCandidates)
 	{
-		if (!enemy->isActive() || !enemy->isAlive()) continue;
+		m_enemies.visit(m_broadphaseEnemies[enemyIndex], [&](auto& enemy) {
+			using Enemy = std::decay_t<decltype(enemy)>;
+			if (!enemy.isActive() || !enemy.isAlive()) return;
 
-		const RectF enemyRect = enemy->getCollisionRect();
+			const RectF enemyRect = enemy.getCollisionRect();
+			if (!playerRect.intersects(enemyRect)) return;
 
-		if (playerRect.intersects(enemyRect))
-		{
 			// 特殊な敵の処理
-			handleSpecialEnemyCollision(enemy.get());
+			handleSpecialEnemyCollision(enemy);
 
 			// 踏みつけ判定（1ブロック基準で改良）
-			if (isPlayerStompingEnemy(playerRect, enemyRect) &&
-				canStompEnemy(enemy.get()) &&
-				enemy->getState() != EnemyState::Flattened)
+			// Saw・SpikeSlime は踏めない（プレイヤーがダメージを受ける）
+			if (Enemy::STOMPABLE &&
+				isPlayerStompingEnemy(playerRect, enemyRect) &&
+				enemy.isActive() && enemy.isAlive() &&
+				enemy.getState() != EnemyState::Flattened)
 			{
-				handlePlayerStompEnemy(enemy.get());
+				handlePlayerStompEnemy(&enemy);
 			}
-			else
+			else if (!m_player->isInvincible() && enemy.getState() != EnemyState::Flattened)
 			{
-				// 横からの衝突（ダメージ）
-				if (!m_player->isInvincible() && enemy->getState() != EnemyState::Flattened)
-				{
-					bool shouldTakeDamage = false;
-
-					switch (enemy->getType())
-					{
-					case EnemyType::Saw:
-					case EnemyType::SpikeSlime:
-						shouldTakeDamage = true;  // 常に危険
-						break;
-					default:
-						shouldTakeDamage = true;  // 通常の敵からもダメージ
-						break;
-					}
-
-					if (shouldTakeDamage)
-					{
-						handlePlayerHitByEnemy(enemy.get());
-					}
-				}
+				// 横からの衝突（ダメージ）。どの敵からも受ける
+				handlePlayerHitByEnemy(&enemy);
 			}
-		}
+		});
 	}
 }
 
@@ -1289,89 +1656,121 @@ void GameScene::updateEnemyStageCollision()
 {
 	if (!m_stage) return;
 
-	const Array<RectF> collisionRects = m_stage->getCollisionRects();
-
-	for (auto& enemy : m_enemies)
-	{
-		if (!enemy->isActive() || !enemy->isAlive()) continue;
+	m_enemies.forEach([&](auto& enemy) {
+		using Enemy = std::decay_t<decltype(enemy)>;
+		if (!enemy.isActive() || !enemy.isAlive() || enemy.isSleeping()) return;
 
-		const Vec2 enemyPos = enemy->getPosition();
-		const RectF enemyRect = enemy->getCollisionRect();
+		const Vec2 enemyPos = enemy.getPosition();
+		const RectF enemyRect = enemy.getCollisionRect();
 		bool isOnGround = false;
+		size_t testedRectCount = 0;
 
-		// 各ブロックとの衝突をチェック
-		for (const auto& blockRect : collisionRects)
-		{
-			if (enemyRect.intersects(blockRect))
-			{
-				// 衝突方向を判定
-				const Vec2 enemyCenter = enemyRect.center();
-				const Vec2 blockCenter = blockRect.center();
-				const Vec2 distance = enemyCenter - blockCenter;
+		// 敵と重なるタイルだけを走査し、最初に当たったブロックで押し戻す
+		m_stage->forEachSolidRectIn(enemyRect, [&](const RectF& blockRect) {
+			++testedRectCount;
 
-				// X方向とY方向の重複を計算
-				const double overlapX = (enemyRect.w + blockRect.w) / 2.0 - std::abs(distance.x);
-				const double overlapY = (enemyRect.h + blockRect.h) / 2.0 - std::abs(distance.y);
+			// 衝突方向を判定
+			const Vec2 enemyCenter = enemyRect.center();
+			const Vec2 blockCenter = blockRect.center();
+			const Vec2 distance = enemyCenter - blockCenter;
 
-				// より小さい重複の方向で押し戻し
-				if (overlapX < overlapY)
+			// X方向とY方向の重複を計算
+			const double overlapX = (enemyRect.w + blockRect.w) / 2.0 - std::abs(distance.x);
+			const double overlapY = (enemyRect.h + blockRect.h) / 2.0 - std::abs(distance.y);
+
+			// より小さい重複の方向で押し戻し
+			if (overlapX < overlapY)
+			{
+				// X方向の衝突（壁）
+				Vec2 newPos = enemyPos;
+				if (distance.x > 0)
 				{
-					// X方向の衝突（壁）
-					Vec2 newPos = enemyPos;
-					if (distance.x > 0)
-					{
-						newPos.x = blockRect.x + blockRect.w + enemyRect.w / 2;
-					}
-					else
-					{
-						newPos.x = blockRect.x - enemyRect.w / 2;
-					}
-					enemy->setPosition(newPos);
+					newPos.x = blockRect.x + blockRect.w + enemyRect.w / 2;
+				}
+				else
+				{
+					newPos.x = blockRect.x - enemyRect.w / 2;
+				}
+				enemy.setPosition(newPos);
 
-					// 敵の方向を反転（NormalSlimeの場合）
-					if (enemy->getType() == EnemyType::NormalSlime)
-					{
-						NormalSlime* slime = static_cast<NormalSlime*>(enemy.get());
-						slime->changeDirection();
-					}
+				// 敵の方向を反転（NormalSlimeの場合）
+				if constexpr (std::is_same_v<Enemy, NormalSlime>)
+				{
+					enemy.changeDirection();
+				}
+			}
+			else
+			{
+				// Y方向の衝突
+				Vec2 newPos = enemyPos;
+				Vec2 newVelocity = enemy.getVelocity();
+
+				if (distance.y > 0)
+				{
+					// 敵が上側（天井）
+					newPos.y = blockRect.y + blockRect.h + enemyRect.h / 2;
+					newVelocity.y = 0;
 				}
 				else
 				{
-					// Y方向の衝突
-					Vec2 newPos = enemyPos;
-					Vec2 newVelocity = enemy->getVelocity();
+					// 敵が下側（地面に着地）
+					newPos.y = blockRect.y - enemyRect.h / 2;
+					newVelocity.y = 0;
+					isOnGround = true;
+				}
 
-					if (distance.y > 0)
-					{
-						// 敵が上側（天井）
-						newPos.y = blockRect.y + blockRect.h + enemyRect.h / 2;
-						newVelocity.y = 0;
-					}
-					else
+				enemy.setPosition(newPos);
+				enemy.setVelocity(newVelocity);
+			}
+			return false;
+		});
+
+		if (m_broadphase)
+		{
+			m_broadphase->recordPairTests(testedRectCount, m_stage->getSolidTileCount());
+		}
+
+		enemy.setGrounded(isOnGround);
+
+		// 地面を歩く敵は次のティックで進む分だけ前方を調べ、壁にめり込む前・崖から落ちる前に向きを変える
+		if constexpr (std::is_same_v<Enemy, NormalSlime> || std::is_same_v<Enemy, SpikeSlime> || std::is_same_v<Enemy, Ladybug>)
+		{
+			// 足元からこれより深い段差は崖とみなす（半ブロック）
+			constexpr double LEDGE_PROBE_DISTANCE = 32.0;
+
+			bool isWalking = (enemy.getState() == EnemyState::Walk);
+			if constexpr (std::is_same_v<Enemy, Ladybug>)
+			{
+				isWalking = isWalking && !enemy.isFlyMode();
+			}
+
+			const double stepX = enemy.getVelocity().x * SimulationClock::DeltaTime();
+			if (isWalking && stepX != 0.0)
+			{
+				const RectF rect = enemy.getCollisionRect();
+
+				// 足元・頭上のタイルに接しているだけで当たらないよう上下を1pxずつ縮める
+				if (m_stage->boxcast(rect.stretched(0, -1), Vec2(stepX, 0.0), std::abs(stepX)))
+				{
+					enemy.changeDirection();
+				}
+				else if (isOnGround)
+				{
+					// 進んだ先の先頭の足元から真下へレイを飛ばし、地面がなければ引き返す
+					const Vec2 leadingFoot{ ((0.0 < stepX) ? rect.rightX() : rect.x) + stepX, rect.bottomY() - 1.0 };
+					if (!m_stage->raycast(leadingFoot, Vec2(0.0, 1.0), LEDGE_PROBE_DISTANCE + 1.0))
 					{
-						// 敵が下側（地面に着地）
-						newPos.y = blockRect.y - enemyRect.h / 2;
-						newVelocity.y = 0;
-						isOnGround = true;
+						enemy.changeDirection();
 					}
-
-					enemy->setPosition(newPos);
-					enemy->setVelocity(newVelocity);
 				}
-				break;
 			}
 		}
-
-		enemy->setGrounded(isOnGround);
-	}
+	});
 }
 
-void GameScene::addEnemy(std::unique_ptr<EnemyBase> enemy)
+EnemyHandle GameScene::addEnemy(const String& typeKey, const Vec2& position)
 {
-	if (enemy)
-	{
-		m_enemies.push_back(std::move(enemy));
-	}
+	return spawnEnemy(m_enemies, typeKey, position);
 }
 
 bool GameScene::isPlayerStompingEnemy(const RectF& playerRect, const RectF& enemyRect) const
@@ -1421,7 +1820,7 @@ void GameScene::handlePlayerStompEnemy(EnemyBase* enemy)
 
 void GameScene::updateFireballEnemyCollision()
 {
-	if (!m_player) return;
+	if (!m_player || !m_broadphase) return;
 
 	const auto& fireballs = m_player->getFireballs();
 
@@ -1431,36 +1830,43 @@ void GameScene::updateFireballEnemyCollision()
 
 		const RectF fireballRect(fireball.position.x - 16, fireball.position.y - 16, 32, 32);
 
-		for (auto& enemy : m_enemies)
+		m_broadphase->queryEnemies(fireballRect, m_broadphaseCandidates);
+
+		for (const size_t enemyIndex : m_broadphaseCandidates)
 		{
-			if (!enemy->isActive() || !enemy->isAlive()) continue;
+			bool destroyed = false;
 
-			// Sawには効かない
-			if (enemy->getType() == EnemyType::Saw) continue;
+			m_enemies.visit(m_broadphaseEnemies[enemyIndex], [&](auto& enemy) {
+				using Enemy = std::decay_t<decltype(enemy)>;
 
-			const RectF enemyRect = enemy->getCollisionRect();
+				// Sawには効かない
+				if constexpr (!Enemy::FIREBALL_IMMUNE)
+				{
+					if (!enemy.isActive() || !enemy.isAlive()) return;
+					if (!fireballRect.intersects(enemy.getCollisionRect())) return;
 
-			if (fireballRect.intersects(enemyRect))
-			{
-				// ★ 派手な撃破エフェクトを生成
-				createFireballDestructionEffect(enemy->getPosition(), enemy->getType(), fireball.position);
+					// ★ 派手な撃破エフェクトを生成
+					createFireballDestructionEffect(enemy.getPosition(), enemy.getType(), fireball.position);
 
-				// 敵を撃破
-				enemy->onDestroy();
+					// 敵を撃破
+					enemy.onDestroy();
 
-				if (m_player && !m_player->getTutorialNotifiedFireball()) {
-					m_player->setTutorialNotifiedFireball(true);
-					TutorialEmit(TutorialEvent::FireballKill, enemy->getPosition());
-				}
+					if (m_player && !m_player->getTutorialNotifiedFireball()) {
+						m_player->setTutorialNotifiedFireball(true);
+						TutorialEmit(TutorialEvent::FireballKill, enemy.getPosition());
+					}
 
-				// ファイアボールを無効化
-				m_player->deactivateFireball(fireball.position);
+					// ファイアボールを無効化
+					m_player->deactivateFireball(fireball.position);
 
-				// ★ より派手な効果音を再生
-				SoundManager::GetInstance().playSE(SoundManager::SoundType::SFX_BREAK_BLOCK);
+					// ★ より派手な効果音を再生
+					SoundManager::GetInstance().playSE(SoundManager::SoundType::SFX_BREAK_BLOCK);
 
-				break; // 一つの敵に当たったらループ終了
-			}
+					destroyed = true;
+				}
+			});
+
+			if (destroyed) break; // 一つの敵に当たったらループ終了
 		}
 	}
 }
@@ -1497,77 +1903,31 @@ void GameScene::handlePlayerHitByEnemy(EnemyBase* enemy)
 	m_hudSystem->subtractLife(1);  // ライフを1減らす
 }
 
-// 新敵用の特殊処理メソッド
-void GameScene::handleSpecialEnemyCollision(EnemyBase* enemy)
+// 新敵用の特殊処理メソッド（それ以外の種類はヘッダーのテンプレートで何もしない）
+void GameScene::handleSpecialEnemyCollision(SpikeSlime& spikeSlime)
 {
-	if (!enemy) return;
-
-	switch (enemy->getType())
-	{
-	case EnemyType::SpikeSlime:
+	if (spikeSlime.isDangerous())
 	{
-		SpikeSlime* spikeSlime = static_cast<SpikeSlime*>(enemy);
-		if (spikeSlime->isDangerous())
-		{
-			// SpikeSlimeが危険状態の場合、プレイヤーがダメージを受ける
-			handlePlayerHitByEnemy(enemy);
-		}
-	}
-	break;
-
-	case EnemyType::Saw:
-	{
-		Saw* saw = static_cast<Saw*>(enemy);
-		if (saw->isDangerous())
-		{
-			// Sawは常に危険
-			handlePlayerHitByEnemy(enemy);
-		}
+		// SpikeSlimeが危険状態の場合、プレイヤーがダメージを受ける
+		handlePlayerHitByEnemy(&spikeSlime);
 	}
-	break;
+}
 
-	case EnemyType::Bee:
+void GameScene::handleSpecialEnemyCollision(Saw& saw)
+{
+	if (saw.isDangerous())
 	{
-		Bee* bee = static_cast<Bee*>(enemy);
-		if (m_player)
-		{
-			bee->updateChase(m_player->getPosition());
-		}
-	}
-	break;
-
-	default:
-		// 通常の敵は従来の処理
-		break;
+		// Sawは常に危険
+		handlePlayerHitByEnemy(&saw);
 	}
 }
 
-// 敵を踏めるかどうかの判定
-bool GameScene::canStompEnemy(const EnemyBase* enemy) const
+void GameScene::handleSpecialEnemyCollision(Bee& bee)
 {
-	if (!enemy || !enemy->isActive() || !enemy->isAlive()) return false;
-
-	switch (enemy->getType())
+	if (m_player)
 	{
-	case EnemyType::Saw:
-		// Sawは踏めない（プレイヤーがダメージを受ける）
-		return false;
-
-	case EnemyType::SpikeSlime:
-		// SpikeSlimeは踏めない（常にスパイクがあるためダメージを受ける）
-		return false;
-
-	case EnemyType::Bee:
-	case EnemyType::Fly:
-		// 飛行中の敵は踏みにくいが、可能
-		return true;
-
-	case EnemyType::NormalSlime:
-	case EnemyType::Ladybug:
-	case EnemyType::SlimeBlock:
-	default:
-		// 通常の敵は踏める
-		return true;
+		const ChaseFieldSystem::Sample chase = sampleChaseTarget(bee.getPosition());
+		bee.updateChase(chase.waypoint, chase.pathDistance);
 	}
 }
 
@@ -1631,42 +1991,41 @@ void GameScene::createFireballDestructionEffect(const Vec2& enemyPos, EnemyType
 		break;
 	}
 
-	// パーティクルを生成
+	// パーティクルを生成（プールが満杯なら生成を諦める。乱数は満杯でも同じ数だけ消費する）
 	for (int i = 0; i < effect.particleCount; ++i)
 	{
-		FireballParticle particle;
+		ParticlePool::Particle particle;
 
 		// ファイアボールの方向を基準に少し散らす
 		const double baseAngle = std::atan2(effect.fireballDirection.y, effect.fireballDirection.x);
-		const double angle = baseAngle + Random(-Math::Pi * 0.7, Math::Pi * 0.7);
-		const double speed = Random(150.0, 400.0);
+		const double angle = baseAngle + GameRandom::Range(-Math::Pi * 0.7, Math::Pi * 0.7);
+		const double speed = GameRandom::Range(150.0, 400.0);
 
-		particle.position = enemyPos + Vec2(Random(-10.0, 10.0), Random(-10.0, 10.0));
+		const double offsetX = GameRandom::Range(-10.0, 10.0);
+		const double offsetY = GameRandom::Range(-10.0, 10.0);
+		particle.position = enemyPos + Vec2(offsetX, offsetY);
 		particle.velocity = Vec2(std::cos(angle), std::sin(angle)) * speed;
-		particle.life = Random(0.8, 1.5);
-		particle.maxLife = particle.life;
-		particle.size = Random(3.0, 8.0);
-		particle.rotation = Random(0.0, Math::TwoPi);
-		particle.rotationSpeed = Random(-15.0, 15.0);
+		particle.life = GameRandom::Range(0.8, FIREBALL_PARTICLE_MAX_LIFE);
+		particle.size = GameRandom::Range(3.0, 8.0);
+		particle.rotation = GameRandom::Range(0.0, Math::TwoPi);
+		particle.rotationSpeed = GameRandom::Range(-15.0, 15.0);
 
 		// 色をランダムに選択
 		particle.color = (i % 2 == 0) ? effect.primaryColor : effect.secondaryColor;
 
-		effect.particles.push_back(particle);
+		m_fireballParticles.spawn(particle);
 	}
 
 	// 衝撃波を生成
-	for (int i = 0; i < 3; ++i)
+	for (size_t i = 0; i < FireballDestructionEffect::SHOCKWAVE_COUNT; ++i)
 	{
-		FireballShockwave shockwave;
+		FireballShockwave& shockwave = effect.shockwaves[i];
 		shockwave.position = enemyPos;
 		shockwave.radius = 0.0;
 		shockwave.maxRadius = 80.0 + i * 20.0;
 		shockwave.life = 0.8 + i * 0.2;
 		shockwave.maxLife = shockwave.life;
 		shockwave.delay = i * 0.1;
-
-		effect.shockwaves.push_back(shockwave);
 	}
 
 	// エフェクトリストに追加
@@ -1675,7 +2034,10 @@ void GameScene::createFireballDestructionEffect(const Vec2& enemyPos, EnemyType
 
 void GameScene::updateFireballDestructionEffects()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
+
+	// パーティクルは全エフェクト分をまとめて更新
+	m_fireballParticles.update(deltaTime);
 
 	for (auto it = m_fireballDestructionEffects.begin(); it != m_fireballDestructionEffects.end();)
 	{
@@ -1689,37 +2051,11 @@ void GameScene::updateFireballDestructionEffects()
 
 		effect.timer += deltaTime;
 
-		// パーティクル更新
-		for (auto particleIt = effect.particles.begin(); particleIt != effect.particles.end();)
-		{
-			auto& particle = *particleIt;
-
-			// 物理更新
-			particle.position += particle.velocity * deltaTime;
-			particle.velocity.y += 400.0 * deltaTime; // 重力
-			particle.velocity *= 0.98; // 空気抵抗
-
-			// 回転更新
-			particle.rotation += particle.rotationSpeed * deltaTime;
-
-			// 生存時間更新
-			particle.life -= deltaTime;
-			particle.size *= 0.996;
-
-			if (particle.life <= 0.0 || particle.size <= 0.5)
-			{
-				particleIt = effect.particles.erase(particleIt);
-			}
-			else
-			{
-				++particleIt;
-			}
-		}
-
-		// 衝撃波更新
-		for (auto shockwaveIt = effect.shockwaves.begin(); shockwaveIt != effect.shockwaves.end();)
+		// 衝撃波更新（寿命が尽きたものは life <= 0 のまま残す）
+		bool hasLiveShockwave = false;
+		for (auto& shockwave : effect.shockwaves)
 		{
-			auto& shockwave = *shockwaveIt;
+			if (shockwave.life <= 0.0) continue;
 
 			shockwave.delay -= deltaTime;
 
@@ -1727,24 +2063,13 @@ void GameScene::updateFireballDestructionEffects()
 			{
 				shockwave.life -= deltaTime;
 				shockwave.radius += (shockwave.maxRadius / shockwave.maxLife) * deltaTime;
-
-				if (shockwave.life <= 0.0)
-				{
-					shockwaveIt = effect.shockwaves.erase(shockwaveIt);
-				}
-				else
-				{
-					++shockwaveIt;
-				}
-			}
-			else
-			{
-				++shockwaveIt;
 			}
+
+			hasLiveShockwave = hasLiveShockwave || (shockwave.life > 0.0);
 		}
 
-		// エフェクト終了判定
-		if (effect.particles.empty() && effect.shockwaves.empty())
+		// エフェクト終了判定（このエフェクトのパーティクルは最長寿命を過ぎれば消えている）
+		if (!hasLiveShockwave && effect.timer >= FIREBALL_PARTICLE_MAX_LIFE)
 		{
 			effect.active = false;
 		}
@@ -1810,7 +2135,7 @@ void GameScene::drawDayNightEffects() const
     
     // 時間帯のUI表示
     const Vec2 timeDisplayPos(Scene::Width() - 200, 20);
-    Font timeFont(18, Typeface::Bold);
+    const Font timeFont = FontRegistry::Get(18, Typeface::Bold);
     
     // 時間帯のテキスト
     String phaseText;
@@ -1863,7 +2188,7 @@ void GameScene::drawDayNightEffects() const
         const double pulse = std::sin(Scene::Time() * 3.0) * 0.3 + 0.7;
         const ColorF warningColor = ColorF(1.0, 0.3, 0.3, pulse);
         
-        Font warningFont(24, Typeface::Bold);
+        const Font warningFont = FontRegistry::Get(24, Typeface::Bold);
         const String warningText = U"DANGER! Enemies are aggressive!";
         const Vec2 warningPos(Scene::Center().x - 150, 80);
         
@@ -1884,7 +2209,7 @@ void GameScene::drawDayNightEffects() const
                 starsCollected, 
                 starsCollected * 10  // STAR_TIME_BONUSと同じ値
             );
-            Font(16)(bonusText).draw(timeDisplayPos.x, timeDisplayPos.y + 50, ColorF(1.0, 1.0, 0.5));
+            FontRegistry::Get(16)(bonusText).draw(timeDisplayPos.x, timeDisplayPos.y + 50, ColorF(1.0, 1.0, 0.5));
         }
     }
     
@@ -1912,19 +2237,61 @@ void GameScene::drawDayNightEffects() const
 }
 
 
-void GameScene::drawDayNightUI() const
+void GameScene::drawUILayer() const
 {
-	if (!m_dayNightSystem) return;
+	UILayerState state;
+	state.sceneSize = Scene::Size();
+	if (m_dayNightSystem)
+	{
+		state.time = m_dayNightSystem->getTimeUIState();
+	}
 
-	// UI配置位置の計算
-	const Vec2 gaugePos(Scene::Width() - 250, 20);
-	const Vec2 infoPos(Scene::Width() - 250, 55);
+	if (!m_uiLayer || m_uiLayer.size() != state.sceneSize)
+	{
+		m_uiLayer = RenderTexture{ state.sceneSize, ColorF{ 0.0, 0.0 } };
+		m_uiLayerState.reset();
+	}
 
-	// 時間ゲージUI描画
-	m_dayNightSystem->drawTimeGaugeUI(gaugePos);
+	if (m_uiLayerState != state)
+	{
+		renderUILayer();
+
+		// アニメーション中は次のフレームも描き直す
+		const bool animating = (m_dayNightSystem && m_dayNightSystem->isTimeUIAnimating());
+		m_uiLayerState = animating ? none : Optional<UILayerState>{ state };
+	}
+
+	// レイヤーは乗算済みアルファで保持している
+	const ScopedRenderStates2D blend{ BlendState::Premultiplied };
+	m_uiLayer.draw();
+}
 
-	// 時間情報UI描画
-	m_dayNightSystem->drawTimeInfoUI(infoPos);
+void GameScene::renderUILayer() const
+{
+	m_uiLayer.clear(ColorF{ 0.0, 0.0 });
+
+	// 透明なレンダーテクスチャへ乗算済みアルファで重ねる（半透明どうしの重なりも直接描いた場合と同じ不透明度になる）
+	BlendState blendState = BlendState::Default2D;
+	blendState.srcAlpha = Blend::One;
+	blendState.dstAlpha = Blend::InvSrcAlpha;
+	blendState.opAlpha = BlendOp::Add;
+	const ScopedRenderStates2D blend{ blendState };
+	const ScopedRenderTarget2D target{ m_uiLayer };
+
+	if (m_dayNightSystem)
+	{
+		// 時間ゲージUI描画
+		m_dayNightSystem->drawTimeGaugeUI(Vec2(Scene::Width() - 250, 20));
+
+		// 時間情報UI描画
+		m_dayNightSystem->drawTimeInfoUI(Vec2(Scene::Width() - 250, 55));
+	}
+}
+
+// 画面全体に点滅する昼夜の警告（時間ゲージと時間情報は UI レイヤーに描く）
+void GameScene::drawDayNightUI() const
+{
+	if (!m_dayNightSystem) return;
 
 	// 夜時間中の追加警告表示
 	if (m_dayNightSystem->isNight())
@@ -1962,14 +2329,13 @@ void GameScene::drawNightWarningEffects() const
 		const double messageAlpha = messageTime < 1.0 ?
 			messageTime : (2.0 - messageTime);
 
-		const String warningMsg = U"NIGHT TIME - Enemies are aggressive!";
+		const DrawableText& warningMsg = m_nightWarningText.get();
 		const Vec2 msgPos(Scene::Center().x, 120);
 
-		Font(28, Typeface::Bold)(warningMsg).drawAt(msgPos,
-			ColorF(1.0, 0.2, 0.2, messageAlpha * 0.8));
+		warningMsg.drawAt(msgPos, ColorF(1.0, 0.2, 0.2, messageAlpha * 0.8));
 
 		// 背景の半透明ボックス
-		const SizeF msgSize = Font(28)(warningMsg).region().size;
+		const SizeF msgSize = warningMsg.region().size;
 		RectF(msgPos.x - msgSize.x / 2 - 15, msgPos.y - msgSize.y / 2 - 8,
 			  msgSize.x + 30, msgSize.y + 16)
 			.draw(ColorF(0.0, 0.0, 0.0, messageAlpha * 0.5));
@@ -1993,10 +2359,8 @@ void GameScene::drawSunsetCautionEffects() const
 		const double messageAlpha = messageTime < 0.75 ?
 			messageTime / 0.75 : (1.5 - messageTime) / 0.75;
 
-		const String cautionMsg = U"SUNSET TIME - Be cautious";
 		const Vec2 msgPos(Scene::Center().x, 140);
 
-		Font(20)(cautionMsg).drawAt(msgPos,
-			ColorF(1.0, 0.7, 0.0, messageAlpha * 0.6));
+		m_sunsetCautionText.get().drawAt(msgPos, ColorF(1.0, 0.7, 0.0, messageAlpha * 0.6));
 	}
 }
@@ -1,6 +1,13 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
 #include "../Core/SceneBase.hpp"
+#include "../Core/SimulationClock.hpp"
+#include "../Core/SystemTimings.hpp"
+#include "../Core/FrameProfiler.hpp"
+#include "../Core/GameRandom.hpp"
+#include "../Core/TextureCache.hpp"
+#include "../Core/FontRegistry.hpp"
+#include "../Player/InputReplay.hpp"
 #include "../Player/PlayerColor.hpp"
 #include "../Player/Player.hpp"
 #include "../Stages/Stage.hpp"
@@ -17,30 +24,18 @@
 #include "../Systems/StarSystem.hpp"
 #include "../Systems/BlockSystem.hpp"
 #include "../Systems/CollisionSystem.hpp"
+#include "../Systems/BroadphaseSystem.hpp"
+#include "../Systems/ChaseFieldSystem.hpp"
 #include "../Effects/ShaderEffects.hpp"
+#include "../Effects/PostProcessChain.hpp"
+#include "../Effects/ParticlePool.hpp"
 #include "../Systems/DayNightSystem.hpp"
 #include "../Enemies/EnemyFactory.hpp"
+#include "../Enemies/EnemyPool.hpp"
+#include "../Enemies/EnemySpawnTable.hpp"
 
 // ファイアボール撃破エフェクト用の構造体
-struct FireballParticle
-{
-	Vec2 position;
-	Vec2 velocity;
-	double life;
-	double maxLife;
-	double size;
-	ColorF color;
-	double rotation;
-	double rotationSpeed;
-
-	FireballParticle()
-		: position(Vec2::Zero()), velocity(Vec2::Zero())
-		, life(1.0), maxLife(1.0), size(5.0)
-		, color(ColorF(1.0, 1.0, 1.0)), rotation(0.0), rotationSpeed(0.0)
-	{
-	}
-};
-
+// （パーティクルは GameScene の共有プールで管理し、ここには衝撃波と爆発光だけを持つ）
 struct FireballShockwave
 {
 	Vec2 position;
@@ -59,6 +54,8 @@ struct FireballShockwave
 
 struct FireballDestructionEffect
 {
+	static constexpr size_t SHOCKWAVE_COUNT = 3;
+
 	Vec2 position;
 	Vec2 fireballDirection;
 	EnemyType enemyType;
@@ -67,8 +64,7 @@ struct FireballDestructionEffect
 	int particleCount;
 	ColorF primaryColor;
 	ColorF secondaryColor;
-	Array<FireballParticle> particles;
-	Array<FireballShockwave> shockwaves;
+	std::array<FireballShockwave, SHOCKWAVE_COUNT> shockwaves;
 
 	FireballDestructionEffect()
 		: position(Vec2::Zero()), fireballDirection(Vec2(1, 0))
@@ -84,38 +80,96 @@ class GameScene: public SceneBase
 private:
 	// 基本メンバー変数
 	Texture m_backgroundTexture;
+	TextureLease m_textureLease;
 	Font m_gameFont;
+	CachedText m_controlText;
+	CachedText m_gameOverText;
+	mutable GlyphText m_timeText;  // 0.1秒ごとに変わるので確保せずに組み直せる GlyphText で描く
+	CachedText m_nightWarningText;
+	CachedText m_sunsetCautionText;
 	Optional<SceneType> m_nextScene;
 
 	// ゲームの状態
 	double m_gameTime;
-	std::unique_ptr<Player> m_player;
-	std::unique_ptr<Stage> m_stage;
+	ArenaPtr<Player> m_player;
+	std::unique_ptr<Stage> m_stage;  // デバッグキーで読み直すのでアリーナには置かない
 	StageNumber m_currentStageNumber;
 
 	// 敵システム
-	Array<std::unique_ptr<EnemyBase>> m_enemies;
+	EnemyPool& m_enemies;  // 種類ごとのプール（破棄はティックの最後にまとめて行う）
+	Array<EnemyHandle> m_broadphaseEnemies;  // ブロードフェーズの番号 → 敵
+	size_t m_awakeEnemyCount = 0;
+
+	// 敵の活動範囲（カメラ周辺だけを更新する）
+	// 画面幅は実際のウィンドウではなく固定値で判定する（ヘッドレス実行・リプレイでも同じ結果にするため）
+	static constexpr double ENEMY_ACTIVATION_VIEW_WIDTH = 1920.0;
+	static constexpr double ENEMY_WAKE_MARGIN = 512.0;    // 画面端からこの距離に入ったら起こす
+	static constexpr double ENEMY_SLEEP_MARGIN = 1024.0;  // 画面端からこの距離より離れたら眠らせる
+	static constexpr double ENEMY_DESPAWN_MARGIN = 2048.0;  // 画面の左端からこの距離より後ろへ離れたら出現前に戻す
+
+	// 敵の出現（出現リストのうち、画面端から ENEMY_WAKE_MARGIN 以内に入った敵だけを生成する）
+	enum class EnemySpawnState : uint8
+	{
+		Pending,    // まだ生成していない
+		Spawned,    // 生成済み
+		Despawned,  // 遠く離れて破棄した。出現位置が起こす範囲の外に出たら Pending に戻す
+		Finished   // 倒された（生成に失敗した場合も含む）。二度と生成しない
+	};
+
+	struct EnemySpawnSlot
+	{
+		EnemySpawnState state = EnemySpawnState::Pending;
+		EnemyHandle handle;
+	};
+
+	const Array<EnemySpawn>* m_enemySpawns = nullptr;  // EnemySpawnTable のキャッシュ
+	Array<EnemySpawnSlot> m_enemySpawnSlots;           // m_enemySpawns と同じ並び
+	Array<uint32> m_spawnedEnemyEntries;               // Spawned の出現リストの添字
+	Array<uint32> m_despawnedEnemyEntries;             // Despawned の出現リストの添字
 
 	// ゴール関連
 	bool m_goalReached;
 	double m_goalTimer;
 
 	// UI・収集システム
-	std::unique_ptr<HUDSystem> m_hudSystem;
-	std::unique_ptr<CoinSystem> m_coinSystem;
-	std::unique_ptr<StarSystem> m_starSystem;
-	std::unique_ptr<BlockSystem> m_blockSystem;
+	ArenaPtr<HUDSystem> m_hudSystem;
+	ArenaPtr<CoinSystem> m_coinSystem;
+	ArenaPtr<StarSystem> m_starSystem;
+	ArenaPtr<BlockSystem> m_blockSystem;
 
 	// 新しい統一衝突判定システム
-	std::unique_ptr<CollisionSystem> m_collisionSystem;
+	ArenaPtr<CollisionSystem> m_collisionSystem;
+
+	// プレイヤー・ファイアボールと敵の衝突判定用ブロードフェーズ
+	ArenaPtr<BroadphaseSystem> m_broadphase;
+	Array<size_t> m_broadphaseCandidates;
+
+	// 追跡する敵が共有するプレイヤーまでの距離場（使う敵がいるティックだけ作る）
+	ArenaPtr<ChaseFieldSystem> m_chaseField;
 
 	// ファイアボール撃破エフェクト用メンバー変数
 	Array<FireballDestructionEffect> m_fireballDestructionEffects;
+	ParticlePool m_fireballParticles;  // 全エフェクト共有の破片パーティクル
+	static constexpr size_t FIREBALL_PARTICLE_CAPACITY = 512;
+	static constexpr double FIREBALL_PARTICLE_MAX_LIFE = 1.5;
 
 	//シェーダーエフェクト
-	std::unique_ptr<ShaderEffects> m_shaderEffects;
+	ArenaPtr<ShaderEffects> m_shaderEffects;
+	ArenaPtr<PostProcessChain> m_postProcess;  // m_shaderEffects を参照するので後に宣言する
+
+	ArenaPtr<DayNightSystem> m_dayNightSystem;
+
+	// 昼夜の時間表示を描いた UI レイヤー（ポストエフェクトの後に重ね、表示内容が変わったときだけ描き直す）
+	// HUDSystem は自身のレイヤーを持ち、変わった領域だけを描き直す
+	struct UILayerState
+	{
+		Optional<DayNightSystem::TimeUIState> time;
+		Size sceneSize{ 0, 0 };
 
-	std::unique_ptr<DayNightSystem> m_dayNightSystem;
+		bool operator==(const UILayerState&) const = default;
+	};
+	mutable RenderTexture m_uiLayer;
+	mutable Optional<UILayerState> m_uiLayerState;  // none なら次の描画で描き直す
 
 	// リザルト関連
 	bool m_isLastStage;
@@ -129,6 +183,18 @@ private:
 	static bool s_shouldLoadNextStage;
 	static bool s_shouldRetryStage;
 
+	// シミュレーションの各システムの処理時間（累計）
+	SystemTimings m_systemTimings;
+
+	// フレームごとの更新・描画の内訳（F3 でオーバーレイ表示）
+	mutable FrameProfiler m_frameProfiler;
+	Font m_profilerFont;
+
+	// 入力の記録（シーン終了時に保存し、ヘッドレス実行で再生できる）
+	InputReplay m_sessionReplay;
+	bool m_saveSessionReplay;
+	static constexpr StringView SESSION_REPLAY_PATH = U"Replays/last_session.adrp";
+
 	// 黒い炎テクスチャ
 	Texture m_blackFireTexture;
 	static constexpr int BLACKFIRE_SPRITE_SIZE = 128; // 元のスプライトサイズ
@@ -146,6 +212,17 @@ public:
 	Optional<SceneType> getNextScene() const override;
 	void cleanup() override;
 
+	// 描画用の資源（テクスチャ・フォント・ポストエフェクト）だけを用意する。init() とヘッドレスの描画計測から呼ぶ
+	void initRendering();
+
+	// 描画なしでゲームプレイだけを動かす（ヘッドレス実行用）
+	void initSimulation(StageNumber stageNumber, uint64 seed);
+	void stepSimulation(const PlayerInput& input);
+	const SystemTimings& getSystemTimings() const { return m_systemTimings; }
+	const Player* getPlayer() const { return m_player.get(); }
+	size_t getEnemyCount() const { return m_enemies.size(); }
+	double getGameTime() const { return m_gameTime; }
+
 	// 静的メソッド - リザルトデータ管理用
 	static StageNumber getNextStageNumber() noexcept { return s_nextStageNumber; }
 	static StageNumber getGameOverStage()noexcept { return s_gameOverStage; }
@@ -165,8 +242,13 @@ public:
 	static void setRetryMode() { s_shouldRetryStage = true; s_shouldLoadNextStage = false; }
 
 protected:
-	void addEnemy(std::unique_ptr<EnemyBase> enemy);
+	EnemyHandle addEnemy(const String& typeKey, const Vec2& position);
 private:
+	// 固定ティック
+	void runSimulationTick();
+	void updateSimulation();
+	void savePreviousTickState();
+
 	// ステージ関連
 	void loadStage(StageNumber stageNumber);
 
@@ -177,9 +259,24 @@ private:
 	// 敵システム関連
 	void initEnemies();
 	void updateEnemies();
+	double computeEnemyViewLeft() const;
+	void updateEnemySpawns();
+	void updateEnemyActivation();
+	void updateChaseField();
+	bool isBeeTouchingPlayer();
+	ChaseFieldSystem::Sample sampleChaseTarget(const Vec2& position) const;
+
+	// 変身中の特殊挙動（種類ごとのオーバーロード。該当しない種類は何もしない）
+	void updateNightBehavior(NormalSlime& slime);
+	void updateNightBehavior(SpikeSlime& spike);
+	void updateNightBehavior(Bee& bee);
+	void updateNightBehavior(Fly& fly);
+	template <class Enemy>
+	void updateNightBehavior(Enemy&) {}
 	void drawEnemies() const;
 	void updatePlayerEnemyCollision();
 	void updateEnemyStageCollision();
+	void rebuildEnemyBroadphase();
 
 	// ゴール関連
 	void updateGoalCheck();
@@ -201,9 +298,12 @@ private:
 	void drawEnemyHitEffect(const Vec2& screenPos, const EnemyBase* enemy) const;
 	void drawPlayerFireballs() const;
 
-	// 新敵用の特殊処理
-	void handleSpecialEnemyCollision(EnemyBase* enemy);
-	bool canStompEnemy(const EnemyBase* enemy) const;
+	// 新敵用の特殊処理（種類ごとのオーバーロード。該当しない種類は何もしない）
+	void handleSpecialEnemyCollision(SpikeSlime& spikeSlime);
+	void handleSpecialEnemyCollision(Saw& saw);
+	void handleSpecialEnemyCollision(Bee& bee);
+	template <class Enemy>
+	void handleSpecialEnemyCollision(Enemy&) {}
 
 	// BlockSystem関連のメソッド（簡素化）
 	void updateTotalCoinsFromBlocks();
@@ -217,6 +317,8 @@ private:
 	void updateDayNight();
 	void drawDayNightEffects() const;
 	void drawDayNightUI() const;
+	void drawUILayer() const;
+	void renderUILayer() const;
 	void drawNightWarningEffects() const;
 	void drawSunsetCautionEffects() const;
 };
@@ -1,6 +1,7 @@
 ﻿#include "OptionScene.hpp"
 #include "../Sound/SoundManager.hpp"
 #include "../Core/SceneFactory.hpp"
+#include "../Core/FontRegistry.hpp"
 
 namespace {
 	const bool registered = [] {
@@ -28,9 +29,9 @@ void OptionScene::init()
 	m_buttonTexture = Texture(U"UI/PNG/Yellow/button_rectangle_depth_gradient.png");
 
 	// フォントの初期化
-	m_titleFont = Font(36, Typeface::Bold);
-	m_labelFont = Font(20);
-	m_buttonFont = Font(20, Typeface::Bold);
+	m_titleFont = FontRegistry::Get(36, Typeface::Bold);
+	m_labelFont = FontRegistry::Get(20);
+	m_buttonFont = FontRegistry::Get(20, Typeface::Bold);
 
 	// SoundManagerから現在の設定を取得
 	SoundManager& soundManager = SoundManager::GetInstance();
@@ -1,6 +1,7 @@
 ﻿#include "ResultScene.hpp"
 #include "GameScene.hpp"
 #include "../Core/SceneFactory.hpp"
+#include "../Core/FontRegistry.hpp"
 
 namespace {
 	const bool registered = [] {
@@ -12,7 +13,8 @@ namespace {
 }
 
 ResultScene::ResultScene()
-	: m_selectedButton(0)
+	: m_particles(PARTICLE_CAPACITY, ParticlePool::Motion{ Vec2(0.0, 50.0), Vec2::One(), 1.0, 0.0, Scene::Height() + 50.0 })
+	, m_selectedButton(0)
 	, m_buttonHovered(false)
 	, m_animationTimer(0.0)
 	, m_starAnimationDelay(0.0)
@@ -42,10 +44,10 @@ void ResultScene::init()
 	loadTextures();
 
 	// フォントの初期化
-	m_titleFont = Font(42, Typeface::Bold);
-	m_headerFont = Font(28, Typeface::Bold);
-	m_dataFont = Font(22);
-	m_buttonFont = Font(20, Typeface::Bold);
+	m_titleFont = FontRegistry::Get(42, Typeface::Bold);
+	m_headerFont = FontRegistry::Get(28, Typeface::Bold);
+	m_dataFont = FontRegistry::Get(22);
+	m_buttonFont = FontRegistry::Get(20, Typeface::Bold);
 
 	// GameSceneからリザルトデータを取得
 	StageNumber clearedStage = GameScene::getNextStageNumber();
@@ -324,25 +326,8 @@ void ResultScene::updateParticles()
 {
 	const double deltaTime = Scene::DeltaTime();
 
-	// 既存パーティクルの更新
-	for (auto it = m_particles.begin(); it != m_particles.end();)
-	{
-		auto& particle = *it;
-
-		particle.position += particle.velocity * deltaTime;
-		particle.velocity.y += 50.0 * deltaTime; // 重力
-		particle.life -= deltaTime;
-		particle.rotation += particle.rotationSpeed * deltaTime;
-
-		if (particle.life <= 0.0 || particle.position.y > Scene::Height() + 50)
-		{
-			it = m_particles.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
+	// 既存パーティクルの更新（寿命切れ・画面下に落ちたものは削除）
+	m_particles.update(deltaTime);
 
 	// 新しいパーティクルを追加
 	if (Random(0.0, 1.0) < 0.3)
@@ -381,11 +366,10 @@ void ResultScene::updateFireworks()
 
 void ResultScene::createParticle(const Vec2& position)
 {
-	Particle particle;
+	ParticlePool::Particle particle;
 	particle.position = position;
 	particle.velocity = Vec2(Random(-50.0, 50.0), Random(-100.0, -20.0));
 	particle.life = Random(2.0, 4.0);
-	particle.maxLife = particle.life;
 	particle.rotation = Random(0.0, Math::TwoPi);
 	particle.rotationSpeed = Random(-5.0, 5.0);
 	particle.color = ColorF(
@@ -393,7 +377,7 @@ void ResultScene::createParticle(const Vec2& position)
 		Random(0.7, 1.0),
 		Random(0.8, 1.0)
 	);
-	m_particles.push_back(particle);
+	m_particles.spawn(particle);
 }
 
 void ResultScene::createFireworkExplosion(const Vec2& position)
@@ -404,11 +388,10 @@ void ResultScene::createFireworkExplosion(const Vec2& position)
 		const double angle = Random(0.0, Math::TwoPi);
 		const double speed = Random(100.0, 200.0);
 
-		Particle particle;
+		ParticlePool::Particle particle;
 		particle.position = position;
 		particle.velocity = Vec2(std::cos(angle), std::sin(angle)) * speed;
 		particle.life = Random(1.5, 3.0);
-		particle.maxLife = particle.life;
 		particle.rotation = Random(0.0, Math::TwoPi);
 		particle.rotationSpeed = Random(-10.0, 10.0);
 		particle.color = ColorF(
@@ -416,7 +399,7 @@ void ResultScene::createFireworkExplosion(const Vec2& position)
 			Random(0.3, 0.8),
 			Random(0.2, 0.6)
 		);
-		m_particles.push_back(particle);
+		m_particles.spawn(particle);
 	}
 }
 
@@ -522,7 +505,9 @@ void ResultScene::drawTitle() const
 
 	// タイトルの脈動効果
 	const double pulse = 1.0 + std::sin(m_titlePulseTimer * 3.0) * 0.15;
-	const Font pulseFont = Font(static_cast<int>(42 * pulse), Typeface::Bold);
+	// フォントは最大サイズで1つだけ用意し、描画サイズで拡縮する
+	const Font pulseFont = FontRegistry::Get(48, Typeface::Bold);
+	const double pulseSize = 42.0 * pulse;
 
 	// 複数レイヤーでグロー効果
 	for (int i = 4; i >= 0; --i)
@@ -541,7 +526,7 @@ void ResultScene::drawTitle() const
 			color = HSV(hue * 360.0, 0.6, 1.0, alpha).toColorF();
 		}
 
-		pulseFont(title).drawAt(titlePos + offset, color);
+		pulseFont(title).drawAt(pulseSize, titlePos + offset, color);
 	}
 }
 
@@ -756,28 +741,30 @@ void ResultScene::drawButtons() const
 
 void ResultScene::drawParticles() const
 {
-	for (const auto& particle : m_particles)
+	for (size_t i = 0; i < m_particles.size(); ++i)
 	{
-		const double alpha = particle.life / particle.maxLife;
+		const Vec2 position = m_particles.getPosition(i);
+		const double alpha = m_particles.getLifeRatio(i);
+		const ColorF& baseColor = m_particles.getColor(i);
 		const ColorF color = ColorF(
-			particle.color.r,
-			particle.color.g,
-			particle.color.b,
+			baseColor.r,
+			baseColor.g,
+			baseColor.b,
 			alpha * 0.8
 		);
 
-		const double size = 3.0 + std::sin(particle.rotation) * 1.0;
-		Circle(particle.position, size).draw(color);
+		const double size = 3.0 + std::sin(m_particles.getRotation(i)) * 1.0;
+		Circle(position, size).draw(color);
 
 		// キラキラエフェクト
 		const double sparkleSize = size * 0.7;
 		Line(
-			particle.position.x - sparkleSize, particle.position.y,
-			particle.position.x + sparkleSize, particle.position.y
+			position.x - sparkleSize, position.y,
+			position.x + sparkleSize, position.y
 		).draw(1.0, color);
 		Line(
-			particle.position.x, particle.position.y - sparkleSize,
-			particle.position.x, particle.position.y + sparkleSize
+			position.x, position.y - sparkleSize,
+			position.x, position.y + sparkleSize
 		).draw(1.0, color);
 	}
 }
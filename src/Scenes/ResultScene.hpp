@@ -4,6 +4,7 @@
 #include "../Stages/Stage.hpp"
 #include "../Player/PlayerColor.hpp"
 #include "../Sound/SoundManager.hpp"
+#include "../Effects/ParticlePool.hpp"
 
 class ResultScene final : public SceneBase
 {
@@ -51,19 +52,9 @@ private:
 
 	Array<BackgroundBlock> m_backgroundBlocks;
 
-	// パーティクル構造体
-	struct Particle
-	{
-		Vec2 position;
-		Vec2 velocity;
-		double life;
-		double maxLife;
-		double rotation;
-		double rotationSpeed;
-		ColorF color;
-	};
-
-	Array<Particle> m_particles;
+	// 紙吹雪・花火のパーティクル
+	static constexpr size_t PARTICLE_CAPACITY = 256;
+	ParticlePool m_particles;
 
 	// 花火構造体（3つ星時の特別エフェクト）
 	struct Firework
@@ -1,6 +1,7 @@
 ﻿#include "SplashScene.hpp"
 #include "../Sound/SoundManager.hpp"
 #include "../Core/SceneFactory.hpp"
+#include "../Core/FontRegistry.hpp"
 
 namespace {
 	const bool registered = [] {
@@ -15,6 +16,7 @@ SplashScene::SplashScene()
 	: m_timer(0.0)
 	, m_totalDuration(7.0)
 	, m_currentPhase(Phase::FadeIn)
+	, m_particles(EXPLOSION_PARTICLE_COUNT, ParticlePool::Motion{ Vec2(0.0, 300.0), Vec2(0.98, 0.98), 0.99 })
 	, m_explosionTimer(0.0)
 	, m_textRevealTimer(0.0)
 	, m_skipRequested(false)
@@ -29,8 +31,8 @@ void SplashScene::init()
 	m_bombActiveTexture = Texture(U"Sprites/Tiles/bomb_active.png");
 
 	// フォントの初期化
-	m_companyFont = Font(48, Typeface::Bold);
-	m_poweredByFont = Font(20);
+	m_companyFont = FontRegistry::Get(48, Typeface::Bold);
+	m_poweredByFont = FontRegistry::Get(20);
 
 	// 初期化
 	m_timer = 0.0;
@@ -40,12 +42,8 @@ void SplashScene::init()
 	m_skipRequested = false;
 	m_nextScene = none;
 
-	// パーティクル配列の初期化
+	// パーティクルの初期化
 	m_particles.clear();
-	m_particleColors.clear();
-	m_particleLifetime.clear();
-	m_particleVelocities.clear();
-	m_particleSizes.clear();
 
 	// 衝撃波用配列の初期化
 	m_shockwaves.clear();
@@ -220,10 +218,6 @@ void SplashScene::cleanup()
 {
 	// リソースのクリーンアップ（BGMは停止しない）
 	m_particles.clear();
-	m_particleColors.clear();
-	m_particleLifetime.clear();
-	m_particleVelocities.clear();
-	m_particleSizes.clear();
 	m_shockwaves.clear();
 	m_shockwaveTimers.clear();
 }
@@ -302,17 +296,15 @@ void SplashScene::updateFadeOut()
 void SplashScene::createExplosionParticles()
 {
 	const Vec2 center = getBombPosition();
-	const int particleCount = 80;
 
-	for (int i = 0; i < particleCount; ++i)
+	for (int i = 0; i < EXPLOSION_PARTICLE_COUNT; ++i)
 	{
 		const double angle = Random(0.0, Math::TwoPi);
 		const double speed = Random(150.0, 500.0);
-		const Vec2 velocity = Vec2(std::cos(angle), std::sin(angle)) * speed;
 
-		const Vec2 startPos = center + Vec2(Random(-30.0, 30.0), Random(-30.0, 30.0));
-
-		m_particles.push_back(startPos);
+		ParticlePool::Particle particle;
+		particle.velocity = Vec2(std::cos(angle), std::sin(angle)) * speed;
+		particle.position = center + Vec2(Random(-30.0, 30.0), Random(-30.0, 30.0));
 
 		ColorF color;
 		const double colorType = Random(0.0, 1.0);
@@ -329,10 +321,11 @@ void SplashScene::createExplosionParticles()
 			color = ColorF(Random(0.8, 1.0), Random(0.0, 0.3), Random(0.0, 0.2));
 		}
 
-		m_particleColors.push_back(color);
-		m_particleLifetime.push_back(Random(1.0, 2.5));
-		m_particleVelocities.push_back(velocity);
-		m_particleSizes.push_back(Random(2.0, 8.0));
+		particle.color = color;
+		particle.life = Random(1.0, PARTICLE_MAX_LIFE);
+		particle.size = Random(2.0, 8.0);
+
+		m_particles.spawn(particle);
 	}
 }
 
@@ -349,29 +342,7 @@ void SplashScene::createShockwaves()
 
 void SplashScene::updateParticles()
 {
-	const double deltaTime = Scene::DeltaTime();
-
-	for (size_t i = 0; i < m_particles.size(); )
-	{
-		m_particleLifetime[i] -= deltaTime;
-
-		if (m_particleLifetime[i] <= 0.0)
-		{
-			m_particles.erase(m_particles.begin() + i);
-			m_particleColors.erase(m_particleColors.begin() + i);
-			m_particleLifetime.erase(m_particleLifetime.begin() + i);
-			m_particleVelocities.erase(m_particleVelocities.begin() + i);
-			m_particleSizes.erase(m_particleSizes.begin() + i);
-		}
-		else
-		{
-			m_particles[i] += m_particleVelocities[i] * deltaTime;
-			m_particleVelocities[i].y += 300.0 * deltaTime;
-			m_particleVelocities[i] *= 0.98;
-			m_particleSizes[i] *= 0.99;
-			++i;
-		}
-	}
+	m_particles.update(Scene::DeltaTime());
 }
 
 void SplashScene::updateShockwaves()
@@ -398,10 +369,10 @@ void SplashScene::drawParticles() const
 {
 	for (size_t i = 0; i < m_particles.size(); ++i)
 	{
-		const double alpha = m_particleLifetime[i] / 2.5;
-		const ColorF color = m_particleColors[i];
-		const Vec2 pos = m_particles[i];
-		const double size = m_particleSizes[i];
+		const double alpha = m_particles.getLife(i) / PARTICLE_MAX_LIFE;
+		const ColorF& color = m_particles.getColor(i);
+		const Vec2 pos = m_particles.getPosition(i);
+		const double size = m_particles.getSize(i);
 
 		Circle(pos, size).draw(ColorF(color.r, color.g, color.b, alpha));
 		Circle(pos, size * 1.5).draw(ColorF(color.r, color.g, color.b, alpha * 0.3));
@@ -477,8 +448,8 @@ void SplashScene::drawCompanyText(double alpha) const
 			glowColor = ColorF(0.8, 0.8, 1.0, glowAlpha);
 		}
 
-		const auto scaledFont = Font(static_cast<int>(48 * glowSize), Typeface::Bold);
-		scaledFont(companyText).drawAt(textPos + glowOffset, glowColor);
+		// フォントは最大サイズで1つだけ用意し、描画サイズで拡縮する
+		FontRegistry::Get(60, Typeface::Bold)(companyText).drawAt(48.0 * glowSize, textPos + glowOffset, glowColor);
 	}
 }
 
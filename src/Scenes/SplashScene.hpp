@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
 #include "../Core/SceneBase.hpp"
+#include "../Effects/ParticlePool.hpp"
 
 class SplashScene final : public SceneBase
 {
@@ -31,11 +32,9 @@ private:
 	Phase m_currentPhase;
 
 	// 強化されたパーティクルシステム
-	Array<Vec2> m_particles;
-	Array<ColorF> m_particleColors;
-	Array<double> m_particleLifetime;
-	Array<Vec2> m_particleVelocities;  // 速度ベクトル
-	Array<double> m_particleSizes;     // パーティクルサイズ
+	static constexpr int EXPLOSION_PARTICLE_COUNT = 80;
+	static constexpr double PARTICLE_MAX_LIFE = 2.5;
+	ParticlePool m_particles;
 
 	// 衝撃波エフェクト
 	Array<Vec2> m_shockwaves;
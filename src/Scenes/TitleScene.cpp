@@ -1,4 +1,5 @@
 ﻿#include "TitleScene.hpp"
+#include "../Core/FontRegistry.hpp"
 #include "../Sound/SoundManager.hpp"
 #include "../Core/SceneFactory.hpp"
 
@@ -30,9 +31,9 @@ void TitleScene::init()
 	m_buttonTexture = Texture(U"UI/PNG/Yellow/button_rectangle_depth_gradient.png");
 
 	// フォントの初期化
-	m_titleFont = Font(48, Typeface::Bold);
-	m_messageFont = Font(24);
-	m_buttonFont = Font(20, Typeface::Bold);
+	m_titleFont = FontRegistry::Get(48, Typeface::Bold);
+	m_messageFont = FontRegistry::Get(24);
+	m_buttonFont = FontRegistry::Get(20, Typeface::Bold);
 
 	// ボタンの設定
 	setupButtons();
@@ -326,7 +327,7 @@ void TitleScene::drawButtons() const
 		}
 
 		// ボタンテキストの描画
-		const Font largeButtonFont = Font(26, Typeface::Bold);
+		const Font largeButtonFont = FontRegistry::Get(26, Typeface::Bold);
 		ColorF textColor = isSelected ? ColorF(0.1, 0.1, 0.1) : ColorF(0.9, 0.9, 0.9);
 
 		if (isSelected)
@@ -381,7 +382,7 @@ void TitleScene::drawSoundDebugInfo() const
 		soundManager.isBGMPlaying() ? U"Yes" : U"No"
 	);
 
-	Font(16)(debugInfo).draw(10, 10, ColorF(1.0, 1.0, 0.0));
+	FontRegistry::Get(16)(debugInfo).draw(10, 10, ColorF(1.0, 1.0, 0.0));
 }
 
 void TitleScene::executeButton(int buttonIndex)
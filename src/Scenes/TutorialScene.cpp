@@ -1,4 +1,5 @@
 ﻿#include "TutorialScene.hpp"
+#include "../Core/FontRegistry.hpp"
 #include "../Core/SceneFactory.hpp"
 
 namespace {
@@ -68,7 +69,7 @@ void TutorialScene::draw() const
 		msgBox.draw(ColorF(0.0, 0.0, 0.0, 0.7));
 		msgBox.drawFrame(2, ColorF(1.0, 1.0, 0.6));
 
-		Font(20, Typeface::Bold)(U"ENTER または SPACE でタイトルへ")
+		FontRegistry::Get(20, Typeface::Bold)(U"ENTER または SPACE でタイトルへ")
 			.drawAt(msgBox.center(), ColorF(1.0, 1.0, 0.8));
 	}
 }
@@ -117,12 +118,12 @@ void TutorialScene::spawnFor(Step s)
 	switch (s) {
 	case Step::Stomp: {
 		//踏みやすい位置にスライムを配置
-		addEnemy(spawnEnemy(U"NormalSlime", Vec2{ 500, 768 }));
+		addEnemy(U"NormalSlime", Vec2{ 500, 768 });
 		break;
 	}
 	case Step::Fireball: {
 		//ファイアボールで倒しやすい位置にBeeを配置
-		addEnemy(spawnEnemy(U"Bee", Vec2{ 700, 600 }));
+		addEnemy(U"Bee", Vec2{ 700, 600 });
 		break;
 	}
 	default: break;
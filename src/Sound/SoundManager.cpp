@@ -1,7 +1,10 @@
 ﻿#include "SoundManager.hpp"
+#include "../Core/TraceCapture.hpp"
 
 void SoundManager::init()
 {
+	const ScopedTrace trace{ U"SoundManager::init" };
+
 	// サウンドファイルパスの設定
 	setupSoundPaths();
 
@@ -1,4 +1,7 @@
 ﻿#include "Stage.hpp"
+#include "../Core/FontRegistry.hpp"
+#include "../Core/SimulationClock.hpp"
+#include "../Core/TraceCapture.hpp"
 
 // ステージ設定の静的配列
 const Array<Stage::StageConfig> Stage::s_stageConfigs = {
@@ -16,7 +19,11 @@ Stage::Stage()
 	, m_stageName(U"Default Stage")
 	, m_backgroundColor(ColorF(0.4, 0.7, 0.9))
 	, m_skyColor(ColorF(0.6, 0.8, 1.0))
+	, m_gridWidth(0)
+	, m_solidTileCount(0)
 	, m_cameraOffset(Vec2::Zero())
+	, m_previousCameraOffset(Vec2::Zero())
+	, m_renderCameraOffset(Vec2::Zero())
 	, m_stagePixelWidth(STAGE_WIDTH* BLOCK_SIZE)
 	, m_hasGoal(false)
 	, m_goalAnimationTimer(0.0)
@@ -43,13 +50,20 @@ void Stage::init(StageNumber stageNumber)
 		m_skyColor = config.skyColor;
 	}
 
+	// ステージ名は変わらないので読み込み時に組んでおく
+	m_titleText = CachedText{ FontRegistry::Get(24, Typeface::Bold) };
+	m_titleText.set(U"Stage {} - {}"_fmt(static_cast<int>(m_stageNumber), m_stageName));
+
 	// カメラとステージサイズの初期化
 	m_cameraOffset = Vec2::Zero();
+	m_previousCameraOffset = Vec2::Zero();
+	m_renderCameraOffset = Vec2::Zero();
 	m_stagePixelWidth = STAGE_WIDTH * BLOCK_SIZE;
 	m_hasGoal = false;
 	m_goalAnimationTimer = 0.0;
 
-	// テクスチャ読み込み
+	// テクスチャ読み込み（前のステージの参照はここで返す）
+	m_textureLease.releaseAll();
 	loadTerrainTextures();
 	loadGoalTextures();
 
@@ -60,31 +74,20 @@ void Stage::init(StageNumber stageNumber)
 void Stage::update(const Vec2& playerPosition)
 {
 	// ★ カメラのスクロール処理を1ブロック基準で調整
-	const double screenCenterX = Scene::Width() / 2.0;
-	const double targetCameraX = playerPosition.x - screenCenterX;
-
-	// ステージの境界でクランプ（1ブロック基準）
-	const double maxCameraX = m_stagePixelWidth - Scene::Width();
-
-	if (m_stagePixelWidth > Scene::Width())
-	{
-		m_cameraOffset.x = Math::Clamp(targetCameraX, 0.0, maxCameraX);
-	}
-	else
-	{
-		m_cameraOffset.x = 0.0;
-	}
+	m_cameraOffset.x = computeCameraX(playerPosition.x, Scene::Width());
 
 	// Y軸のカメラ追従は無効（横スクロールのみ）
 	m_cameraOffset.y = 0.0;
 
 	// ゴールアニメーションタイマー更新
-	m_goalAnimationTimer += Scene::DeltaTime();
+	m_goalAnimationTimer += SimulationClock::DeltaTime();
 }
 
 void Stage::loadTerrainTextures()
 {
-	m_terrainTextures.clear();
+	const ScopedTrace trace{ U"Stage::loadTerrainTextures" };
+
+	m_blockTextures.fill(Texture{});
 
 	const String terrainStr = getTerrainString(m_terrainType);
 	const String basePath = U"Sprites/Tiles/";
@@ -106,12 +109,11 @@ void Stage::loadTerrainTextures()
 	{
 		const String filename = U"terrain_{}_block_{}.png"_fmt(terrainStr, blockStr);
 		const String filepath = basePath + filename;
-		const String key = buildTextureKey(m_terrainType, blockType);
 
-		Texture texture(filepath);
+		const Texture texture = m_textureLease.acquire(filepath);
 		if (texture)
 		{
-			m_terrainTextures[key] = texture;
+			m_blockTextures[static_cast<size_t>(blockType)] = texture;
 		}
 		else
 		{
@@ -122,12 +124,11 @@ void Stage::loadTerrainTextures()
 	// 空中プラットフォーム用のシンプルブロックも読み込み
 	const String simpleBlockFilename = U"terrain_{}_block.png"_fmt(terrainStr);
 	const String simpleBlockFilepath = basePath + simpleBlockFilename;
-	const String simpleBlockKey = U"{}_simple"_fmt(terrainStr);
 
-	Texture simpleBlockTexture(simpleBlockFilepath);
+	const Texture simpleBlockTexture = m_textureLease.acquire(simpleBlockFilepath);
 	if (simpleBlockTexture)
 	{
-		m_terrainTextures[simpleBlockKey] = simpleBlockTexture;
+		m_blockTextures[static_cast<size_t>(BlockType::Simple)] = simpleBlockTexture;
 	}
 	else
 	{
@@ -139,8 +140,8 @@ void Stage::loadGoalTextures()
 {
 	const String basePath = U"Sprites/Tiles/";
 
-	m_goalFlagA = Texture(basePath + U"flag_blue_a.png");
-	m_goalFlagB = Texture(basePath + U"flag_blue_b.png");
+	m_goalFlagA = m_textureLease.acquire(basePath + U"flag_blue_a.png");
+	m_goalFlagB = m_textureLease.acquire(basePath + U"flag_blue_b.png");
 
 	if (!m_goalFlagA)
 	{
@@ -210,6 +211,93 @@ void Stage::generateStageLayout()
 		generateGrassStageLayout(); // フォールバック
 		break;
 	}
+
+	// 配置済みブロックから衝突判定用のタイルグリッドを構築
+	rebuildTileGrid();
+
+	// 描画用のチャンクは最初の描画時に焼き込む（描画できる状態で作るため）
+	m_terrainChunks.clear();
+	m_terrainChunksDirty = true;
+}
+
+void Stage::generateSyntheticLayout(int widthInBlocks)
+{
+	m_blocks.clear();
+
+	// 8ブロックごとに穴、16ブロックごとに3ブロック幅の足場を置く
+	const int groundLevel = getGroundLevel();
+	for (int x = 0; x < widthInBlocks; ++x)
+	{
+		if (x % 8 == 5) continue;
+
+		for (int y = groundLevel; y < STAGE_HEIGHT; ++y)
+		{
+			createAirPlatform(x, y, 1);
+		}
+	}
+	for (int x = 2; x + 3 <= widthInBlocks; x += 16)
+	{
+		createAirPlatform(x, groundLevel - 4, 3);
+	}
+
+	rebuildTileGrid();
+	m_stagePixelWidth = m_gridWidth * BLOCK_SIZE;
+	m_hasGoal = false;
+
+	m_terrainChunks.clear();
+	m_terrainChunksDirty = true;
+}
+
+void Stage::rebuildTileGrid()
+{
+	// ステージ右端からはみ出した足場も判定できるよう、グリッド幅を配置に合わせて広げる
+	m_gridWidth = STAGE_WIDTH;
+	for (const auto& block : m_blocks)
+	{
+		if (block.isSolid && block.blockType != BlockType::Empty)
+		{
+			m_gridWidth = Max(m_gridWidth, worldToGridPosition(block.position).x + 1);
+		}
+	}
+
+	m_tiles.assign(static_cast<size_t>(m_gridWidth) * STAGE_HEIGHT, StageTile{});
+	m_solidTileCount = 0;
+
+	for (const auto& block : m_blocks)
+	{
+		if (!block.isSolid || block.blockType == BlockType::Empty) continue;
+
+		const Point gridPos = worldToGridPosition(block.position);
+		if (gridPos.x < 0 || gridPos.y < 0 || gridPos.y >= STAGE_HEIGHT) continue;
+
+		StageTile& tile = m_tiles[static_cast<size_t>(gridPos.y) * m_gridWidth + gridPos.x];
+		if (!tile.isSolid)
+		{
+			++m_solidTileCount;
+		}
+		tile.blockType = block.blockType;
+		tile.isSolid = true;
+	}
+}
+
+const StageTile* Stage::getTile(int gridX, int gridY) const
+{
+	if (gridX < 0 || gridX >= m_gridWidth || gridY < 0 || gridY >= STAGE_HEIGHT)
+	{
+		return nullptr;
+	}
+	return &m_tiles[static_cast<size_t>(gridY) * m_gridWidth + gridX];
+}
+
+bool Stage::getOverlappingGridRange(const RectF& rect, Point& minCell, Point& maxCell) const
+{
+	// RectF::intersects と同じく境界で接するだけのセルは含めない
+	minCell.x = Max(static_cast<int>(Math::Floor(rect.x / BLOCK_SIZE)), 0);
+	minCell.y = Max(static_cast<int>(Math::Floor(rect.y / BLOCK_SIZE)), 0);
+	maxCell.x = Min(static_cast<int>(Math::Ceil((rect.x + rect.w) / BLOCK_SIZE)) - 1, m_gridWidth - 1);
+	maxCell.y = Min(static_cast<int>(Math::Ceil((rect.y + rect.h) / BLOCK_SIZE)) - 1, STAGE_HEIGHT - 1);
+
+	return (minCell.x <= maxCell.x) && (minCell.y <= maxCell.y);
 }
 
 void Stage::generateGrassStageLayout()
@@ -492,16 +580,115 @@ void Stage::drawBackground() const
 	Scene::Rect().draw(Arg::top = m_skyColor, Arg::bottom = m_backgroundColor);
 
 	// ステージ名表示（右上）
-	Font titleFont(24, Typeface::Bold);
-	const String stageTitle = U"Stage {} - {}"_fmt(static_cast<int>(m_stageNumber), m_stageName);
-	titleFont(stageTitle).draw(Arg::topRight(Scene::Width() - 10, 10), ColorF(1.0, 1.0, 1.0, 0.8));
+	m_titleText.get().draw(Arg::topRight(Scene::Width() - 10, 10), ColorF(1.0, 1.0, 1.0, 0.8));
 }
 
 void Stage::drawBlocks() const
 {
+	// 地形は配置後に変わらないので、チャンクに焼き込んだものを画面に重なる分だけ描く
+	if (m_terrainChunksDirty)
+	{
+		bakeTerrainChunks();
+	}
+
+	if (m_terrainChunks.isEmpty())
+	{
+		// 焼き込めない環境ではタイルごとに描く
+		for (const auto& block : m_blocks)
+		{
+			drawBlock(block);
+		}
+		return;
+	}
+
+	constexpr double chunkPixelWidth = TERRAIN_CHUNK_COLUMNS * BLOCK_SIZE;
+	const double viewLeft = m_renderCameraOffset.x - m_terrainChunkOriginX;
+	const int firstChunk = Max(static_cast<int>(Math::Floor(viewLeft / chunkPixelWidth)), 0);
+	const int lastChunk = Min(static_cast<int>(Math::Floor((viewLeft + Scene::Width()) / chunkPixelWidth)),
+		static_cast<int>(m_terrainChunks.size()) - 1);
+
+	// チャンクは乗算済みアルファで保持している
+	const ScopedRenderStates2D blend{ BlendState::Premultiplied };
+	for (int chunkIndex = firstChunk; chunkIndex <= lastChunk; ++chunkIndex)
+	{
+		m_terrainChunks[chunkIndex].draw(worldToScreenPosition(Vec2(m_terrainChunkOriginX + chunkIndex * chunkPixelWidth, 0.0)));
+	}
+}
+
+void Stage::bakeTerrainChunks() const
+{
+	m_terrainChunksDirty = false;
+	m_terrainChunks.clear();
+
+	constexpr int chunkPixelWidth = TERRAIN_CHUNK_COLUMNS * BLOCK_SIZE;
+	const Size chunkSize{ chunkPixelWidth, STAGE_HEIGHT * BLOCK_SIZE };
+
+	// 描く範囲（テクスチャが1ブロックより大きい場合も含める）
+	const auto getBlockExtent = [&](const StageBlock& block) {
+		const Texture* texture = findBlockTexture(block.terrain, block.blockType);
+		const double width = texture ? Max<double>(texture->width(), BLOCK_SIZE) : BLOCK_SIZE;
+		return std::pair<double, double>{ block.position.x, block.position.x + width };
+	};
+
+	// 左端は x < 0 にはみ出した足場も含めてチャンク幅に揃える
+	double minX = 0.0;
+	double maxX = m_gridWidth * static_cast<double>(BLOCK_SIZE);
 	for (const auto& block : m_blocks)
 	{
-		drawBlock(block);
+		if (block.blockType == BlockType::Empty) continue;
+
+		const auto [left, right] = getBlockExtent(block);
+		minX = Min(minX, left);
+		maxX = Max(maxX, right);
+	}
+	m_terrainChunkOriginX = Math::Floor(minX / chunkPixelWidth) * chunkPixelWidth;
+	const int chunkCount = static_cast<int>(Math::Ceil((maxX - m_terrainChunkOriginX) / chunkPixelWidth));
+
+	// ブロックを重なるチャンクごとに振り分ける（チャンクの境界をまたぐブロックは両方に入れる）
+	Array<Array<uint32>> chunkBlocks(chunkCount);
+	for (size_t i = 0; i < m_blocks.size(); ++i)
+	{
+		const StageBlock& block = m_blocks[i];
+		if (block.blockType == BlockType::Empty) continue;
+
+		const auto [left, right] = getBlockExtent(block);
+		const int firstChunk = static_cast<int>(Math::Floor((left - m_terrainChunkOriginX) / chunkPixelWidth));
+		const int lastChunk = Min(static_cast<int>(Math::Ceil((right - m_terrainChunkOriginX) / chunkPixelWidth)) - 1, chunkCount - 1);
+
+		for (int chunkIndex = firstChunk; chunkIndex <= lastChunk; ++chunkIndex)
+		{
+			chunkBlocks[chunkIndex].push_back(static_cast<uint32>(i));
+		}
+	}
+
+	for (int chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+	{
+		const RenderTexture chunk{ chunkSize, ColorF{ 0.0, 0.0 } };
+		if (!chunk)
+		{
+			m_terrainChunks.clear();
+			return;
+		}
+		m_terrainChunks.push_back(chunk);
+	}
+
+	// 透明なレンダーテクスチャへ乗算済みアルファで重ねる（半透明どうしの重なりも直接描いた場合と同じ不透明度になる）
+	BlendState blendState = BlendState::Default2D;
+	blendState.srcAlpha = Blend::One;
+	blendState.dstAlpha = Blend::InvSrcAlpha;
+	blendState.opAlpha = BlendOp::Add;
+	const ScopedRenderStates2D blend{ blendState };
+
+	for (int chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+	{
+		const ScopedRenderTarget2D target{ m_terrainChunks[chunkIndex] };
+		const Vec2 chunkOrigin{ m_terrainChunkOriginX + chunkIndex * chunkPixelWidth, 0.0 };
+
+		for (const uint32 blockIndex : chunkBlocks[chunkIndex])
+		{
+			const StageBlock& block = m_blocks[blockIndex];
+			drawBlockAt(block, block.position - chunkOrigin);
+		}
 	}
 }
 
@@ -554,22 +741,15 @@ void Stage::drawBlock(const StageBlock& block) const
 	// 画面外カリング（最適化）
 	if (screenPos.x < -BLOCK_SIZE || screenPos.x > Scene::Width() + BLOCK_SIZE) return;
 
-	// Simpleブロック（空中プラットフォーム）の特別処理
-	if (block.blockType == BlockType::Simple)
-	{
-		const String simpleBlockKey = U"{}_simple"_fmt(getTerrainString(block.terrain));
-		if (m_terrainTextures.contains(simpleBlockKey))
-		{
-			m_terrainTextures.at(simpleBlockKey).draw(screenPos);
-			return;
-		}
-	}
+	drawBlockAt(block, screenPos);
+}
 
-	// 通常のブロック描画
-	const Texture texture = getBlockTexture(block.terrain, block.blockType);
-	if (texture)
+void Stage::drawBlockAt(const StageBlock& block, const Vec2& pos) const
+{
+	// 通常のブロック・Simpleブロック（空中プラットフォーム）とも読み込み時に解決済みのテクスチャを描く
+	if (const Texture* texture = findBlockTexture(block.terrain, block.blockType))
 	{
-		texture.draw(screenPos);
+		texture->draw(pos);
 	}
 	else
 	{
@@ -587,59 +767,47 @@ void Stage::drawBlock(const StageBlock& block) const
 			}
 			}();
 
-		RectF(screenPos, BLOCK_SIZE, BLOCK_SIZE).draw(fallbackColor);
+		RectF(pos, BLOCK_SIZE, BLOCK_SIZE).draw(fallbackColor);
 	}
 }
 
 bool Stage::checkCollision(const RectF& rect) const
 {
-	// ★ 1ブロック基準での正確な衝突判定
-	for (const auto& block : m_blocks)
-	{
-		if (block.isSolid && block.blockType != BlockType::Empty)
-		{
-			const RectF blockRect(block.position, BLOCK_SIZE, BLOCK_SIZE);
-			if (rect.intersects(blockRect))
-			{
-				return true;
-			}
-		}
-	}
-	return false;
+	// ★ 矩形が重なるセルだけをタイルグリッドから直接参照
+	// 固体タイルが1つでも見つかった時点で走査を打ち切る
+	return !forEachSolidRectIn(rect, [](const RectF&) { return false; });
 }
 
 Array<RectF> Stage::getCollisionRects() const
 {
-	// ★ 全ての固体ブロックの矩形を64x64基準で返す
+	// ★ 互換用：全ての固体タイルの矩形を64x64基準で返す
 	Array<RectF> collisionRects;
-	collisionRects.reserve(m_blocks.size()); // パフォーマンス向上
+	collisionRects.reserve(m_solidTileCount);
 
-	for (const auto& block : m_blocks)
-	{
-		if (block.isSolid && block.blockType != BlockType::Empty)
-		{
-			collisionRects.push_back(RectF(block.position, BLOCK_SIZE, BLOCK_SIZE));
-		}
-	}
+	forEachSolidRectIn(getTileGridBounds(), [&](const RectF& tileRect) {
+		collisionRects.push_back(tileRect);
+		return true;
+	});
 	return collisionRects;
 }
 
 Vec2 Stage::worldToScreenPosition(const Vec2& worldPos) const
 {
 	// ★ カメラオフセットを考慮した正確な座標変換
-	return worldPos - m_cameraOffset;
+	return worldPos - m_renderCameraOffset;
 }
 
 Vec2 Stage::screenToWorldPosition(const Vec2& screenPos) const
 {
 	// ★ スクリーン座標からワールド座標への変換
-	return screenPos + m_cameraOffset;
+	return screenPos + m_renderCameraOffset;
 }
 
 void Stage::drawCollisionDebug() const
 {
 	// デバッグ用：見えない当たり判定矩形を半透明で描画
 #ifdef _DEBUG
+	const Font tileFont = FontRegistry::Get(12);
 	for (const auto& block : m_blocks)
 	{
 		if (block.isSolid && block.blockType != BlockType::Empty)
@@ -654,14 +822,14 @@ void Stage::drawCollisionDebug() const
 
 				// ★ グリッド座標とワールド座標を表示
 				const Point gridPos = worldToGridPosition(block.position);
-				Font(12)(U"({},{})"_fmt(gridPos.x, gridPos.y))
+				tileFont(U"({},{})"_fmt(gridPos.x, gridPos.y))
 					.draw(screenPos + Vec2(4, 4), ColorF(1.0, 1.0, 0.0));
 			}
 		}
 	}
 
 	// ★ デバッグ情報をテキストで表示（64x64基準）
-	Font debugFont(16);
+	const Font debugFont = FontRegistry::Get(16);
 	const String debugInfo = U"Block Size: {}px | Grid: {}x{} | Ground Level: Block {}"_fmt(
 		BLOCK_SIZE,
 		STAGE_WIDTH,
@@ -729,23 +897,182 @@ bool Stage::isWithinStageBounds(const Vec2& position) const
 		position.y >= 0 && position.y <= STAGE_HEIGHT * BLOCK_SIZE;
 }
 
-bool Stage::isBlockSolid(int gridX, int gridY) const{
+bool Stage::isBlockSolid(int gridX, int gridY) const
+{
+	// ★ タイルグリッドを直接参照（範囲外は非固体）
+	const StageTile* tile = getTile(gridX, gridY);
+	return tile && tile->isSolid;
+}
+
+Optional<StageRaycastHit> Stage::raycast(const Vec2& origin, const Vec2& direction, double maxDistance) const
+{
+	const double length = direction.length();
+	if (length <= 0.0) return none;
 
-	// ★ グリッド座標での正確なブロック判定
-	if (gridX < 0 || gridX >= STAGE_WIDTH || gridY < 0 || gridY >= STAGE_HEIGHT)
+	const Vec2 dir = direction / length;
+
+	int cellX = static_cast<int>(Math::Floor(origin.x / BLOCK_SIZE));
+	int cellY = static_cast<int>(Math::Floor(origin.y / BLOCK_SIZE));
+
+	if (isBlockSolid(cellX, cellY))
 	{
-		return false; // 範囲外は非固体
+		return StageRaycastHit{ Point(cellX, cellY), Vec2::Zero(), 0.0, origin };
 	}
 
-	for (const auto& block : m_blocks)
+	const int stepX = (0.0 < dir.x) - (dir.x < 0.0);
+	const int stepY = (0.0 < dir.y) - (dir.y < 0.0);
+
+	// 次のタイル境界までの距離と、タイル1つ分進むのに必要な距離
+	double tMaxX = Math::Inf;
+	double tMaxY = Math::Inf;
+	double tDeltaX = Math::Inf;
+	double tDeltaY = Math::Inf;
+
+	if (stepX != 0)
+	{
+		tMaxX = (((stepX > 0) ? (cellX + 1) : cellX) * BLOCK_SIZE - origin.x) / dir.x;
+		tDeltaX = BLOCK_SIZE / std::abs(dir.x);
+	}
+	if (stepY != 0)
+	{
+		tMaxY = (((stepY > 0) ? (cellY + 1) : cellY) * BLOCK_SIZE - origin.y) / dir.y;
+		tDeltaY = BLOCK_SIZE / std::abs(dir.y);
+	}
+
+	while (true)
+	{
+		double distance;
+		Vec2 normal;
+
+		if (tMaxX < tMaxY)
+		{
+			cellX += stepX;
+			distance = tMaxX;
+			tMaxX += tDeltaX;
+			normal = Vec2(-stepX, 0);
+		}
+		else
+		{
+			cellY += stepY;
+			distance = tMaxY;
+			tMaxY += tDeltaY;
+			normal = Vec2(0, -stepY);
+		}
+
+		if (maxDistance < distance) return none;
+
+		// グリッドの外へ出て離れていく場合はもう当たらない
+		if ((stepX < 0 && cellX < 0) || (stepX > 0 && m_gridWidth <= cellX)
+			|| (stepY < 0 && cellY < 0) || (stepY > 0 && STAGE_HEIGHT <= cellY))
+		{
+			return none;
+		}
+
+		if (isBlockSolid(cellX, cellY))
+		{
+			return StageRaycastHit{ Point(cellX, cellY), normal, distance, origin + dir * distance };
+		}
+	}
+}
+
+Optional<StageRaycastHit> Stage::boxcast(const RectF& box, const Vec2& direction, double maxDistance) const
+{
+	const double length = direction.length();
+	if (length <= 0.0) return none;
+
+	const Vec2 dir = direction / length;
+
+	// 開始時点で重なっているタイルがあればそれを返す
+	Optional<StageRaycastHit> overlap;
+	forEachSolidRectIn(box, [&](const RectF& tileRect) {
+		overlap = StageRaycastHit{ worldToGridPosition(tileRect.center()), Vec2::Zero(), 0.0, box.pos };
+		return false;
+	});
+	if (overlap) return overlap;
+
+	const int stepX = (0.0 < dir.x) - (dir.x < 0.0);
+	const int stepY = (0.0 < dir.y) - (dir.y < 0.0);
+
+	// 先頭の辺が次に入る列・行と、そこまでの距離（境界に接している場合は 0）
+	int nextColumn = 0;
+	int nextRow = 0;
+	double tMaxX = Math::Inf;
+	double tMaxY = Math::Inf;
+	double tDeltaX = Math::Inf;
+	double tDeltaY = Math::Inf;
+
+	if (stepX != 0)
+	{
+		const double leadX = (stepX > 0) ? (box.x + box.w) : box.x;
+		const int boundary = (stepX > 0)
+			? static_cast<int>(Math::Ceil(leadX / BLOCK_SIZE))
+			: static_cast<int>(Math::Floor(leadX / BLOCK_SIZE));
+		nextColumn = (stepX > 0) ? boundary : (boundary - 1);
+		tMaxX = (boundary * BLOCK_SIZE - leadX) / dir.x;
+		tDeltaX = BLOCK_SIZE / std::abs(dir.x);
+	}
+	if (stepY != 0)
 	{
-		const Point blockGrid = worldToGridPosition(block.position);
-		if (blockGrid.x == gridX && blockGrid.y == gridY)
+		const double leadY = (stepY > 0) ? (box.y + box.h) : box.y;
+		const int boundary = (stepY > 0)
+			? static_cast<int>(Math::Ceil(leadY / BLOCK_SIZE))
+			: static_cast<int>(Math::Floor(leadY / BLOCK_SIZE));
+		nextRow = (stepY > 0) ? boundary : (boundary - 1);
+		tMaxY = (boundary * BLOCK_SIZE - leadY) / dir.y;
+		tDeltaY = BLOCK_SIZE / std::abs(dir.y);
+	}
+
+	const double gridRight = static_cast<double>(m_gridWidth) * BLOCK_SIZE;
+	const double gridBottom = static_cast<double>(STAGE_HEIGHT) * BLOCK_SIZE;
+
+	while (true)
+	{
+		const bool crossesColumn = (tMaxX < tMaxY);
+		const double distance = crossesColumn ? tMaxX : tMaxY;
+		if (maxDistance < distance) return none;
+
+		const RectF moved = box.movedBy(dir * distance);
+
+		// グリッドの外へ出て離れていく場合はもう当たらない
+		if ((stepX < 0 && moved.x + moved.w <= 0.0) || (stepX > 0 && gridRight <= moved.x)
+			|| (stepY < 0 && moved.y + moved.h <= 0.0) || (stepY > 0 && gridBottom <= moved.y))
+		{
+			return none;
+		}
+
+		if (crossesColumn)
 		{
-			return block.isSolid;
+			// 入った列のうち、矩形の縦の範囲のタイル（境界で接するだけのタイルは含めない）
+			const int minRow = Max(static_cast<int>(Math::Floor(moved.y / BLOCK_SIZE)), 0);
+			const int maxRow = Min(static_cast<int>(Math::Ceil((moved.y + moved.h) / BLOCK_SIZE)) - 1, STAGE_HEIGHT - 1);
+			for (int row = minRow; row <= maxRow; ++row)
+			{
+				if (isBlockSolid(nextColumn, row))
+				{
+					return StageRaycastHit{ Point(nextColumn, row), Vec2(-stepX, 0), distance, moved.pos };
+				}
+			}
+
+			nextColumn += stepX;
+			tMaxX += tDeltaX;
+		}
+		else
+		{
+			// 入った行のうち、矩形の横の範囲のタイル
+			const int minColumn = Max(static_cast<int>(Math::Floor(moved.x / BLOCK_SIZE)), 0);
+			const int maxColumn = Min(static_cast<int>(Math::Ceil((moved.x + moved.w) / BLOCK_SIZE)) - 1, m_gridWidth - 1);
+			for (int column = minColumn; column <= maxColumn; ++column)
+			{
+				if (isBlockSolid(column, nextRow))
+				{
+					return StageRaycastHit{ Point(column, nextRow), Vec2(0, -stepY), distance, moved.pos };
+				}
+			}
+
+			nextRow += stepY;
+			tMaxY += tDeltaY;
 		}
 	}
-	return false;
 }
 
 Vec2 Stage::getGroundPosition(double x) const
@@ -754,12 +1081,15 @@ Vec2 Stage::getGroundPosition(double x) const
 
 	// ★ 1ブロック基準での地面検索
 	// 上から下に向かって最初に見つかるソリッドブロックの上面を返す
-	for (int gridY = 0; gridY < STAGE_HEIGHT; ++gridY)
+	if (0 <= gridX && gridX < m_gridWidth)
 	{
-		if (isBlockSolid(gridX, gridY))
+		for (int gridY = 0; gridY < STAGE_HEIGHT; ++gridY)
 		{
-			// ブロックの上面の位置を返す
-			return Vec2(x, gridY * BLOCK_SIZE);
+			if (m_tiles[static_cast<size_t>(gridY) * m_gridWidth + gridX].isSolid)
+			{
+				// ブロックの上面の位置を返す
+				return Vec2(x, gridY * BLOCK_SIZE);
+			}
 		}
 	}
 
@@ -773,6 +1103,17 @@ Vec2 Stage::gridToWorldPosition(int gridX, int gridY) const
 	return Vec2(gridX * BLOCK_SIZE, gridY * BLOCK_SIZE);
 }
 
+double Stage::computeCameraX(double focusX, double viewWidth) const
+{
+	// 注視点を画面中央に置き、ステージの境界でクランプ（1ブロック基準）
+	if (m_stagePixelWidth <= viewWidth)
+	{
+		return 0.0;
+	}
+
+	return Math::Clamp(focusX - viewWidth / 2.0, 0.0, m_stagePixelWidth - viewWidth);
+}
+
 Point Stage::worldToGridPosition(const Vec2& worldPos) const
 {
 	// ★ ワールド座標からグリッド座標への変換（64x64基準）
@@ -936,17 +1277,14 @@ void Stage::createHorizontalPlatform(int startX, int y, int width)
 	}
 }
 
-String Stage::buildTextureKey(TerrainType terrain, BlockType blockType) const
+const Texture* Stage::findBlockTexture(TerrainType terrain, BlockType blockType) const
 {
-	return U"{}_{}"_fmt(getTerrainString(terrain), getBlockTypeString(blockType));
-}
-
-Texture Stage::getBlockTexture(TerrainType terrain, BlockType blockType) const
-{
-	const String key = buildTextureKey(terrain, blockType);
-	if (m_terrainTextures.contains(key))
+	// 読み込んでいるのは現在の地形のテクスチャだけ
+	if (terrain != m_terrainType || blockType == BlockType::Empty)
 	{
-		return m_terrainTextures.at(key);
+		return nullptr;
 	}
-	return Texture{};
+
+	const Texture& texture = m_blockTextures[static_cast<size_t>(blockType)];
+	return texture ? &texture : nullptr;
 }
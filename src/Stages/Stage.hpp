@@ -1,5 +1,8 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
+#include "../Core/TextureCache.hpp"
+#include "../Core/FontRegistry.hpp"
+#include <array>
 
 // 地形の種類
 enum class TerrainType
@@ -54,6 +57,22 @@ struct StageBlock
 	}
 };
 
+// タイルグリッドの1セル（行優先配列で保持する）
+struct StageTile
+{
+	BlockType blockType = BlockType::Empty;
+	bool isSolid = false;  // 衝突判定があるかどうか
+};
+
+// Stage::raycast() / boxcast() で最初に当たった固体タイル
+struct StageRaycastHit
+{
+	Point cell;       // 当たったタイルのグリッド座標
+	Vec2 normal;      // 当たった面の法線（開始時点で重なっていた場合は Zero）
+	double distance;  // 当たるまでに進んだ距離（px）
+	Vec2 position;    // 当たった位置（ボックスキャストはその時点のボックスの左上）
+};
+
 class Stage
 {
 private:
@@ -61,18 +80,34 @@ private:
 	StageNumber m_stageNumber;
 	TerrainType m_terrainType;
 	String m_stageName;
+	CachedText m_titleText;  // 右上のステージ名
 	ColorF m_backgroundColor;
 	ColorF m_skyColor;
 
 	// ブロック関連
 	Array<StageBlock> m_blocks;
-	HashTable<String, Texture> m_terrainTextures;
+
+	// 地形を列方向のチャンクに焼き込んだもの（描画は画面に重なるチャンクだけ）
+	static constexpr int TERRAIN_CHUNK_COLUMNS = 8;
+	mutable Array<RenderTexture> m_terrainChunks;
+	mutable double m_terrainChunkOriginX = 0.0;  // 先頭のチャンクの左端（x < 0 にはみ出した足場も含める）
+	mutable bool m_terrainChunksDirty = true;
+	static constexpr size_t BLOCK_TEXTURE_COUNT = static_cast<size_t>(BlockType::Empty);  // Empty 以外
+	std::array<Texture, BLOCK_TEXTURE_COUNT> m_blockTextures;  // 現在の地形のブロック（BlockType で引く）
+	TextureLease m_textureLease;  // 地形・ゴールのテクスチャの参照
+
+	// 衝突判定用のタイルグリッド（index = gridY * m_gridWidth + gridX）
+	Array<StageTile> m_tiles;
+	int m_gridWidth;  // グリッドの幅（ステージ外にはみ出した足場も含む）
+	size_t m_solidTileCount;
 	static constexpr int BLOCK_SIZE = 64;  // ブロック1つのサイズ
 	static constexpr int STAGE_WIDTH = 80;  // ステージの幅（ブロック数）
 	static constexpr int STAGE_HEIGHT = 17; // ステージの高さ（ブロック数）
 
 	// カメラ・スクロール関連
 	Vec2 m_cameraOffset;
+	Vec2 m_previousCameraOffset;  // 直前のティック開始時のカメラ位置
+	Vec2 m_renderCameraOffset;    // 描画用：前後のティック間を補間したカメラ位置
 	double m_stagePixelWidth;  // ステージの実際の幅（ピクセル）
 
 	// ステージ設定
@@ -104,6 +139,9 @@ public:
 	void loadTerrainTextures();
 	void generateStageLayout();
 
+	// ベンチマーク用：テクスチャを読まずに指定幅（ブロック数）の平坦な地面・穴・足場を並べる
+	void generateSyntheticLayout(int widthInBlocks);
+
 	void createAirPlatform(int startX, int y, int width);
 
 	// 更新・描画
@@ -112,6 +150,7 @@ public:
 	void drawBackground() const;
 	void drawBlocks() const;
 	void drawBlock(const StageBlock& block) const;
+	void drawBlockAt(const StageBlock& block, const Vec2& pos) const;
 
 	// ステージ情報取得
 	StageNumber getStageNumber() const { return m_stageNumber; }
@@ -120,12 +159,58 @@ public:
 	ColorF getBackgroundColor() const { return m_backgroundColor; }
 	Vec2 getCameraOffset() const { return m_cameraOffset; }
 
+	// 指定した注視点・画面幅のときのカメラ左端（update() と同じ追従・クランプ）
+	double computeCameraX(double focusX, double viewWidth) const;
+
+	// 描画補間（worldToScreenPosition() は補間後のカメラ位置を使う）
+	void savePreviousCameraOffset() { m_previousCameraOffset = m_cameraOffset; }
+	void setInterpolationAlpha(double alpha) { m_renderCameraOffset = m_previousCameraOffset.lerp(m_cameraOffset, alpha); }
+	Vec2 getRenderCameraOffset() const { return m_renderCameraOffset; }
+
 	// 衝突判定
 	bool checkCollision(const RectF& rect) const;
 	bool isWithinStageBounds(const Vec2& position) const;
 	bool isBlockSolid(int gridX, int gridY) const;
 	Vec2 getGroundPosition(double x) const;  // 指定X座標での地面位置を取得
-	Array<RectF> getCollisionRects() const;
+	Array<RectF> getCollisionRects() const;  // 互換用（更新処理では forEachSolidRectIn() を使う）
+	size_t getSolidTileCount() const { return m_solidTileCount; }
+	RectF getTileGridBounds() const { return RectF(0, 0, m_gridWidth * BLOCK_SIZE, STAGE_HEIGHT * BLOCK_SIZE); }
+	int getGridWidth() const { return m_gridWidth; }
+	int getGridHeight() const { return STAGE_HEIGHT; }
+	int getBlockSize() const { return BLOCK_SIZE; }
+
+	// 固体タイルへのレイキャスト（グリッドの DDA で通過するタイルだけを調べる。direction は正規化不要）
+	Optional<StageRaycastHit> raycast(const Vec2& origin, const Vec2& direction, double maxDistance) const;
+
+	// 矩形を direction へ maxDistance まで動かしたときに最初に当たる固体タイル
+	// 先頭の辺が新しい列・行に入るたびに、その列・行のうち矩形の幅の分だけを調べる
+	Optional<StageRaycastHit> boxcast(const RectF& box, const Vec2& direction, double maxDistance) const;
+
+	// 指定範囲と重なる固体タイルの矩形を visitor に渡す（メモリ確保なし）
+	// visitor が false を返すと走査を打ち切り、その場合は false を返す
+	template <class Visitor>
+	bool forEachSolidRectIn(const RectF& area, Visitor&& visitor) const
+	{
+		Point minCell, maxCell;
+		if (!getOverlappingGridRange(area, minCell, maxCell)) return true;
+
+		for (int gridY = minCell.y; gridY <= maxCell.y; ++gridY)
+		{
+			const StageTile* row = &m_tiles[static_cast<size_t>(gridY) * m_gridWidth];
+			for (int gridX = minCell.x; gridX <= maxCell.x; ++gridX)
+			{
+				if (!row[gridX].isSolid) continue;
+
+				const RectF tileRect(gridX * BLOCK_SIZE, gridY * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE);
+				if (!visitor(tileRect))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
 	Vec2 screenToWorldPosition(const Vec2& screenPos) const;
 	Vec2 worldToScreenPosition(const Vec2& worldPos) const;
 	void drawCollisionDebug() const;         // デバッグ用衝突判定描画
@@ -171,9 +256,16 @@ private:
 	void createHorizontalPlatform(int startX, int y, int width);
 	BlockType determineGroundBlockType(int localX, int localY, int totalWidth, int totalHeight) const;
 
-	// テクスチャ関連
-	String buildTextureKey(TerrainType terrain, BlockType blockType) const;
-	Texture getBlockTexture(TerrainType terrain, BlockType blockType) const;
+	// タイルグリッド関連
+	void rebuildTileGrid();
+	const StageTile* getTile(int gridX, int gridY) const;
+	bool getOverlappingGridRange(const RectF& rect, Point& minCell, Point& maxCell) const;
+
+	// テクスチャ関連（見つからなければ nullptr）
+	const Texture* findBlockTexture(TerrainType terrain, BlockType blockType) const;
+
+	// 地形チャンクの焼き込み
+	void bakeTerrainChunks() const;
 
 	// ゴール描画
 	void drawGoalFlag() const;
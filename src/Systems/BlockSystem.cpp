@@ -2,9 +2,11 @@
 #include "../Player/Player.hpp"
 #include "../Stages/Stage.hpp"
 #include "../Sound/SoundManager.hpp"
+#include "../Core/SimulationClock.hpp"
 
 BlockSystem::BlockSystem()
-	: m_coinsFromBlocks(0)
+	: m_fragments(FRAGMENT_CAPACITY, ParticlePool::Motion{ Vec2(0.0, FRAGMENT_GRAVITY), Vec2(0.995, 1.0) })
+	, m_coinsFromBlocks(0)
 {
 }
 
@@ -17,9 +19,11 @@ void BlockSystem::init()
 
 void BlockSystem::loadTextures()
 {
-	m_coinBlockActiveTexture = Texture(U"Sprites/Tiles/block_coin_active.png");
-	m_coinBlockEmptyTexture = Texture(U"Sprites/Tiles/block_coin.png");
-	m_brickBlockTexture = Texture(U"Sprites/Tiles/block_empty.png");
+	m_textureLease.releaseAll();
+
+	m_coinBlockActiveTexture = m_textureLease.acquire(U"Sprites/Tiles/block_coin_active.png");
+	m_coinBlockEmptyTexture = m_textureLease.acquire(U"Sprites/Tiles/block_coin.png");
+	m_brickBlockTexture = m_textureLease.acquire(U"Sprites/Tiles/block_empty.png");
 
 	if (!m_coinBlockActiveTexture) Print << U"Failed to load coin block active texture";
 	if (!m_coinBlockEmptyTexture) Print << U"Failed to load coin block empty texture";
@@ -173,14 +177,6 @@ void BlockSystem::updateBlockInteractions(Player* player)
 			}),
 		m_blocks.end()
 	);
-
-	m_fragments.erase(
-		std::remove_if(m_fragments.begin(), m_fragments.end(),
-			[](const std::unique_ptr<BlockFragment>& fragment) {
-				return !fragment || fragment->life <= 0.0;
-			}),
-		m_fragments.end()
-	);
 }
 
 void BlockSystem::updateBlockAnimation(Block& block)
@@ -188,7 +184,7 @@ void BlockSystem::updateBlockAnimation(Block& block)
 	// バウンスアニメーション更新のみ
 	if (block.bounceTimer > 0.0)
 	{
-		block.bounceTimer -= Scene::DeltaTime();
+		block.bounceTimer -= SimulationClock::DeltaTime();
 
 		if (block.bounceTimer <= 0.0)
 		{
@@ -205,31 +201,24 @@ void BlockSystem::updateBlockAnimation(Block& block)
 
 void BlockSystem::updateFragments()
 {
-	const double deltaTime = Scene::DeltaTime();
 	const double BLOCK_SIZE = 64.0;
 
-	for (auto& fragment : m_fragments)
-	{
-		if (!fragment) continue;
+	// 重力・空気抵抗・寿命はプール側で更新する
+	m_fragments.update(SimulationClock::DeltaTime());
 
-		// 物理更新
-		fragment->position += fragment->velocity * deltaTime;
-		fragment->velocity.y += FRAGMENT_GRAVITY * deltaTime;
-
-		// ★ 地面との衝突処理を1ブロック基準で設定
-		const double GROUND_LEVEL = 12.5 * BLOCK_SIZE; // 地面レベル
-		if (fragment->position.y >= GROUND_LEVEL && fragment->velocity.y > 0 && !fragment->bounced)
+	// ★ 地面との衝突処理を1ブロック基準で設定
+	const double GROUND_LEVEL = 12.5 * BLOCK_SIZE; // 地面レベル
+	const ParticlePool::Columns fragments = m_fragments.columns();
+	for (size_t i = 0; i < m_fragments.size(); ++i)
+	{
+		if (fragments.positionY[i] >= GROUND_LEVEL && fragments.velocityY[i] > 0 && !(fragments.flags[i] & FRAGMENT_BOUNCED))
 		{
-			fragment->position.y = GROUND_LEVEL;
-			fragment->velocity.y *= -0.4;  // バウンス
-			fragment->velocity.x *= 0.8;   // 摩擦
-			fragment->bounced = true;
-			fragment->rotationSpeed *= 0.6;
+			fragments.positionY[i] = GROUND_LEVEL;
+			fragments.velocityY[i] *= -0.4;  // バウンス
+			fragments.velocityX[i] *= 0.8;   // 摩擦
+			fragments.flags[i] |= FRAGMENT_BOUNCED;
+			fragments.rotationSpeed[i] *= 0.6;
 		}
-
-		fragment->velocity.x *= 0.995; // 空気抵抗
-		fragment->rotation += fragment->rotationSpeed * deltaTime;
-		fragment->life -= deltaTime;
 	}
 }
 
@@ -323,8 +312,8 @@ void BlockSystem::createBrickFragments(const Vec2& blockPos)
 		double baseVelY = (i / 2 == 0) ? -1.5 : -0.8; // 上下方向
 
 		// ランダム要素を追加
-		double randomFactorX = Random(-0.5, 0.5);
-		double randomFactorY = Random(0.0, 0.5);
+		double randomFactorX = GameRandom::Range(-0.5, 0.5);
+		double randomFactorY = GameRandom::Range(0.0, 0.5);
 
 		// ★ 速度を1ブロック基準で設定
 		Vec2 velocity(
@@ -335,14 +324,17 @@ void BlockSystem::createBrickFragments(const Vec2& blockPos)
 		// 破片を追加
 		if (i < m_brickFragmentTextures.size())
 		{
-			auto fragment = std::make_unique<BlockFragment>(
-				fragmentPos, velocity, m_brickFragmentTextures[i]
-			);
+			ParticlePool::Particle fragment;
+			fragment.position = fragmentPos;
+			fragment.velocity = velocity;
+			fragment.life = FRAGMENT_LIFE;
+			fragment.size = FRAGMENT_SIZE;
 
 			// より自然な回転速度を設定
-			fragment->rotationSpeed = Random(-10.0, 10.0);
+			fragment.rotationSpeed = GameRandom::Range(-10.0, 10.0);
+			fragment.variant = static_cast<uint8>(i);
 
-			m_fragments.push_back(std::move(fragment));
+			m_fragments.spawn(fragment);
 		}
 	}
 }
@@ -403,34 +395,32 @@ void BlockSystem::drawBlock(const Block& block, const Vec2& cameraOffset) const
 
 void BlockSystem::drawFragments(const Vec2& cameraOffset) const
 {
-	for (const auto& fragment : m_fragments)
+	for (size_t i = 0; i < m_fragments.size(); ++i)
 	{
-		if (!fragment) continue;
-
 		// 画面座標に変換
-		Vec2 screenPos = fragment->position - cameraOffset;
+		Vec2 screenPos = m_fragments.getPosition(i) - cameraOffset;
 
 		// 画面外なら描画しない
 		if (screenPos.x < -64 || screenPos.x > Scene::Width() + 64) continue;
 
 		// 透明度を生存期間に応じて設定
-		double lifeRatio = fragment->life / FRAGMENT_LIFE;
-		double alpha = lifeRatio;
+		double alpha = m_fragments.getLifeRatio(i);
 
-		if (alpha > 0 && fragment->texture)
+		const Texture& texture = m_brickFragmentTextures[m_fragments.getVariant(i)];
+		if (alpha > 0 && texture)
 		{
-			const double fragmentSize = 32.0;
+			const double rotation = m_fragments.getRotation(i);
 
-			if (fragment->rotation != 0.0)
+			if (rotation != 0.0)
 			{
-				Vec2 center = screenPos + Vec2(fragmentSize / 2, fragmentSize / 2);
-				fragment->texture.resized(fragmentSize, fragmentSize)
-					.rotated(fragment->rotation)
+				Vec2 center = screenPos + Vec2(FRAGMENT_SIZE / 2, FRAGMENT_SIZE / 2);
+				texture.resized(FRAGMENT_SIZE, FRAGMENT_SIZE)
+					.rotated(rotation)
 					.drawAt(center, ColorF(1.0, 1.0, 1.0, alpha));
 			}
 			else
 			{
-				fragment->texture.resized(fragmentSize, fragmentSize)
+				texture.resized(FRAGMENT_SIZE, FRAGMENT_SIZE)
 					.draw(screenPos, ColorF(1.0, 1.0, 1.0, alpha));
 			}
 		}
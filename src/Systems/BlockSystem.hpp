@@ -2,6 +2,9 @@
 #include <Siv3D.hpp>
 #include <memory>
 #include <functional>
+#include "../Core/GameRandom.hpp"
+#include "../Core/TextureCache.hpp"
+#include "../Effects/ParticlePool.hpp"
 
 // 前方宣言
 class Player;
@@ -22,24 +25,6 @@ public:
 		DESTROYED       // 破壊された状態（レンガブロック用）
 	};
 
-	// 破片の構造体
-	struct BlockFragment {
-		Vec2 position;              // 位置
-		Vec2 velocity;              // 速度
-		double rotation;            // 回転角度
-		double rotationSpeed;       // 回転速度
-		double life;                // 生存期間
-		double maxLife;             // 最大生存期間
-		Texture texture;            // テクスチャ
-		bool bounced;               // 地面にバウンスしたかのフラグ
-
-		BlockFragment(const Vec2& pos, const Vec2& vel, const Texture& tex)
-			: position(pos), velocity(vel), texture(tex)
-			, rotation(0.0), rotationSpeed(Random(-5.0, 5.0))
-			, life(FRAGMENT_LIFE), maxLife(FRAGMENT_LIFE), bounced(false) {
-		}
-	};
-
 	// 個別のブロック
 	struct Block {
 		Vec2 position;                  // 位置
@@ -71,7 +56,26 @@ public:
 	void clearAllBlocks();
 
 	// 新しい統一衝突判定システム用メソッド
-	Array<RectF> getCollisionRects() const;
+	Array<RectF> getCollisionRects() const;  // 互換用
+
+	// 指定範囲と重なる固体ブロックの矩形を visitor に渡す（メモリ確保なし）
+	// visitor が false を返すと走査を打ち切り、その場合は false を返す
+	template <class Visitor>
+	bool forEachSolidRectIn(const RectF& area, Visitor&& visitor) const
+	{
+		for (const auto& block : m_blocks)
+		{
+			if (!block || !isBlockSolid(*block)) continue;
+
+			const RectF blockRect = getBlockRect(*block);
+			if (blockRect.intersects(area) && !visitor(blockRect))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 	bool hasBlockAt(const Vec2& position) const;
 	void handlePlayerInteraction(Player* player);
 
@@ -100,17 +104,6 @@ public:
 	// ブロックへの読み取り専用アクセス
 	const Array<std::unique_ptr<Block>>& getBlocks() const { return m_blocks; }
 
-	// 個別ブロックの情報取得（安全なアクセス）
-	Array<Block> getActiveBlocks() const {
-		Array<Block> activeBlocks;
-		for (const auto& block : m_blocks) {
-			if (block && block->state != BlockState::DESTROYED) {
-				activeBlocks.push_back(*block);
-			}
-		}
-		return activeBlocks;
-	}
-
 	// ブロックが有効かどうか
 	bool isBlockActive(size_t index) const {
 		if (index >= m_blocks.size() || !m_blocks[index]) return false;
@@ -123,10 +116,11 @@ private:
 	Texture m_coinBlockEmptyTexture;    // 空のコインブロック
 	Texture m_brickBlockTexture;        // レンガブロック
 	Array<Texture> m_brickFragmentTextures; // レンガの破片テクスチャ
+	TextureLease m_textureLease;
 
 	// ブロック管理
 	Array<std::unique_ptr<Block>> m_blocks;
-	Array<std::unique_ptr<BlockFragment>> m_fragments;
+	ParticlePool m_fragments;  // レンガの破片（variant は m_brickFragmentTextures の番号）
 	int m_coinsFromBlocks;
 
 	// 物理・演出定数
@@ -136,6 +130,9 @@ private:
 	static constexpr double BOUNCE_DURATION = 0.3;      // バウンス期間
 	static constexpr double FRAGMENT_GRAVITY = 600.0;   // 破片の重力
 	static constexpr double FRAGMENT_LIFE = 2.0;        // 破片の生存期間
+	static constexpr double FRAGMENT_SIZE = 32.0;       // 破片の描画サイズ
+	static constexpr size_t FRAGMENT_CAPACITY = 256;    // 同時に存在できる破片の数
+	static constexpr uint8 FRAGMENT_BOUNCED = 1;        // 地面にバウンスしたかのフラグ
 
 	// ヘルパー関数
 	void loadTextures();
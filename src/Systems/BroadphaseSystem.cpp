@@ -0,0 +1,130 @@
+﻿#include "BroadphaseSystem.hpp"
+
+BroadphaseSystem::BroadphaseSystem(double cellSize)
+	: m_cellSize(cellSize)
+	, m_origin(Vec2::Zero())
+	, m_columns(1)
+	, m_rows(1)
+	, m_cells(1)
+	, m_enemyCount(0)
+	, m_queryStamp(0)
+{
+}
+
+void BroadphaseSystem::setWorldBounds(const RectF& worldBounds)
+{
+	// 画面外へ出た敵の分も余白を取る
+	const RectF bounds = worldBounds.stretched(m_cellSize * 2);
+
+	m_origin = bounds.pos;
+	m_columns = Max(static_cast<int>(Math::Ceil(bounds.w / m_cellSize)), 1);
+	m_rows = Max(static_cast<int>(Math::Ceil(bounds.h / m_cellSize)), 1);
+
+	m_cells.clear();
+	m_cells.resize(static_cast<size_t>(m_columns) * m_rows);
+	m_touchedCells.clear();
+	m_enemyCount = 0;
+}
+
+void BroadphaseSystem::beginFrame()
+{
+	// 前フレームの統計を確定
+	m_lastStats = m_stats;
+	m_stats = Stats{};
+
+	// 敵が登録されたセルだけをクリア（容量は保持して再確保を避ける）
+	for (const uint32 cellIndex : m_touchedCells)
+	{
+		m_cells[cellIndex].enemies.clear();
+	}
+	m_touchedCells.clear();
+	m_enemyCount = 0;
+}
+
+void BroadphaseSystem::insertEnemy(size_t enemyIndex, const RectF& rect)
+{
+	if (m_enemyStamps.size() <= enemyIndex)
+	{
+		m_enemyStamps.resize(enemyIndex + 1, 0);
+	}
+	m_enemyCount = Max(m_enemyCount, enemyIndex + 1);
+
+	Point minCell, maxCell;
+	if (!getCellRange(rect.stretched(ENEMY_MARGIN), minCell, maxCell)) return;
+
+	for (int y = minCell.y; y <= maxCell.y; ++y)
+	{
+		for (int x = minCell.x; x <= maxCell.x; ++x)
+		{
+			const uint32 cellIndex = static_cast<uint32>(y * m_columns + x);
+			Cell& cell = m_cells[cellIndex];
+
+			if (cell.enemies.isEmpty())
+			{
+				m_touchedCells.push_back(cellIndex);
+			}
+			cell.enemies.push_back(static_cast<uint32>(enemyIndex));
+		}
+	}
+}
+
+void BroadphaseSystem::queryEnemies(const RectF& area, Array<size_t>& out)
+{
+	out.clear();
+	m_stats.bruteForcePairs += m_enemyCount;
+
+	Point minCell, maxCell;
+	if (!getCellRange(area, minCell, maxCell)) return;
+
+	const uint32 stamp = nextQueryStamp();
+	for (int y = minCell.y; y <= maxCell.y; ++y)
+	{
+		for (int x = minCell.x; x <= maxCell.x; ++x)
+		{
+			for (const uint32 index : m_cells[static_cast<size_t>(y) * m_columns + x].enemies)
+			{
+				if (m_enemyStamps[index] != stamp)
+				{
+					m_enemyStamps[index] = stamp;
+					out.push_back(index);
+				}
+			}
+		}
+	}
+
+	m_stats.pairTests += out.size();
+}
+
+void BroadphaseSystem::recordPairTests(size_t pairTests, size_t bruteForcePairs)
+{
+	m_stats.pairTests += pairTests;
+	m_stats.bruteForcePairs += bruteForcePairs;
+}
+
+bool BroadphaseSystem::getCellRange(const RectF& rect, Point& minCell, Point& maxCell) const
+{
+	if (m_cells.isEmpty()) return false;
+
+	// グリッド外の部分は端のセルにクランプする（判定漏れを防ぐため保守的に扱う）
+	const auto toCell = [this](double value, double origin, int count) {
+		return Clamp(static_cast<int>(Math::Floor((value - origin) / m_cellSize)), 0, count - 1);
+	};
+
+	minCell.x = toCell(rect.x, m_origin.x, m_columns);
+	minCell.y = toCell(rect.y, m_origin.y, m_rows);
+	maxCell.x = toCell(rect.x + rect.w, m_origin.x, m_columns);
+	maxCell.y = toCell(rect.y + rect.h, m_origin.y, m_rows);
+
+	return true;
+}
+
+uint32 BroadphaseSystem::nextQueryStamp()
+{
+	// スタンプが一周したら記録をリセット
+	if (++m_queryStamp == 0)
+	{
+		m_enemyStamps.fill(0);
+		m_queryStamp = 1;
+	}
+	return m_queryStamp;
+}
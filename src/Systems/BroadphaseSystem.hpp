@@ -0,0 +1,69 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+// 一様グリッドによる敵の衝突判定ブロードフェーズ
+// 敵は毎フレーム登録し直す（地形は Stage::forEachSolidRectIn() でタイルを直接参照する）
+class BroadphaseSystem
+{
+public:
+	// 判定回数の統計（1フレーム分）
+	struct Stats
+	{
+		size_t pairTests = 0;        // 候補として実際に判定した組み合わせ数
+		size_t bruteForcePairs = 0;  // 総当たりの場合に必要だった組み合わせ数
+
+		size_t getAvoidedTests() const
+		{
+			return (bruteForcePairs > pairTests) ? (bruteForcePairs - pairTests) : 0;
+		}
+	};
+
+	explicit BroadphaseSystem(double cellSize = DEFAULT_CELL_SIZE);
+	~BroadphaseSystem() = default;
+
+	// グリッドの対象範囲（範囲外の要素は端のセルにまとめる）
+	void setWorldBounds(const RectF& worldBounds);
+
+	// 敵の登録：フレームの最初に beginFrame() で前フレームの登録を破棄する
+	void beginFrame();
+	void insertEnemy(size_t enemyIndex, const RectF& rect);
+
+	// 指定範囲と重なる可能性のある敵を out に格納（out は呼び出し側で使い回す）
+	void queryEnemies(const RectF& area, Array<size_t>& out);
+
+	size_t getEnemyCount() const { return m_enemyCount; }
+
+	// グリッド外で絞り込んだ判定（地形タイルなど）の回数を統計に加える
+	void recordPairTests(size_t pairTests, size_t bruteForcePairs);
+
+	// 直前に完了したフレームの統計
+	const Stats& getStats() const { return m_lastStats; }
+
+private:
+	struct Cell
+	{
+		Array<uint32> enemies;
+	};
+
+	static constexpr double DEFAULT_CELL_SIZE = 128.0;  // 2ブロック分
+	static constexpr double ENEMY_MARGIN = 32.0;        // フレーム内の押し戻し量を見込んだ余白
+
+	double m_cellSize;
+	Vec2 m_origin;
+	int m_columns;
+	int m_rows;
+	Array<Cell> m_cells;
+	Array<uint32> m_touchedCells;  // 敵が登録されたセル（次フレームのクリア用）
+
+	size_t m_enemyCount;
+
+	// 重複排除用のスタンプ（セルをまたぐ敵を1回だけ返す）
+	Array<uint32> m_enemyStamps;
+	uint32 m_queryStamp;
+
+	Stats m_stats;
+	Stats m_lastStats;
+
+	bool getCellRange(const RectF& rect, Point& minCell, Point& maxCell) const;
+	uint32 nextQueryStamp();
+};
@@ -0,0 +1,145 @@
+﻿#include "ChaseFieldSystem.hpp"
+#include "../Stages/Stage.hpp"
+
+void ChaseFieldSystem::build(const Stage& stage, const Vec2& target, int minColumn, int maxColumn)
+{
+	m_target = target;
+	m_blockSize = stage.getBlockSize();
+	m_minColumn = Max(minColumn, 0);
+	m_columns = Max(Min(maxColumn, stage.getGridWidth() - 1) - m_minColumn + 1, 0);
+	m_rows = stage.getGridHeight();
+	m_isBuilt = false;
+
+	const size_t cellCount = static_cast<size_t>(m_columns) * m_rows;
+	if (cellCount == 0) return;
+
+	// 範囲の大きさが前回以下なら再確保しない
+	m_distances.assign(cellCount, UNREACHED);
+	m_solid.resize(cellCount);
+	for (auto& bucket : m_buckets)
+	{
+		bucket.reserve(cellCount);
+		bucket.clear();
+	}
+
+	for (int row = 0; row < m_rows; ++row)
+	{
+		for (int column = 0; column < m_columns; ++column)
+		{
+			m_solid[toIndex(column, row)] = stage.isBlockSolid(m_minColumn + column, row);
+		}
+	}
+
+	// プレイヤーが範囲の外（画面の上など）にいる場合は一番近いタイルから探索する
+	const int startColumn = Clamp(static_cast<int>(Math::Floor(target.x / m_blockSize)) - m_minColumn, 0, m_columns - 1);
+	const int startRow = Clamp(static_cast<int>(Math::Floor(target.y / m_blockSize)), 0, m_rows - 1);
+	const size_t start = toIndex(startColumn, startRow);
+	m_distances[start] = 0;
+	m_buckets[0].push_back(static_cast<uint32>(start));
+
+	struct Neighbor
+	{
+		Point offset;
+		uint16 cost;
+	};
+
+	static constexpr std::array<Neighbor, 8> NEIGHBORS = {
+		Neighbor{ { 1, 0 }, STRAIGHT_COST }, Neighbor{ { -1, 0 }, STRAIGHT_COST },
+		Neighbor{ { 0, 1 }, STRAIGHT_COST }, Neighbor{ { 0, -1 }, STRAIGHT_COST },
+		Neighbor{ { 1, 1 }, DIAGONAL_COST }, Neighbor{ { -1, 1 }, DIAGONAL_COST },
+		Neighbor{ { 1, -1 }, DIAGONAL_COST }, Neighbor{ { -1, -1 }, DIAGONAL_COST } };
+
+	// 辺の重みが小さい整数なので、距離ごとのバケツを循環させて小さい順に確定する（Dial 法）
+	size_t pending = 1;
+	for (uint32 distance = 0; pending != 0; ++distance)
+	{
+		auto& bucket = m_buckets[distance % m_buckets.size()];
+
+		// 処理中に同じバケツへは積まれない（重みはバケツの数より小さい）
+		for (const uint32 index : bucket)
+		{
+			--pending;
+			if (m_distances[index] != distance) continue;  // より短い経路で確定済み
+
+			const int column = static_cast<int>(index % m_columns);
+			const int row = static_cast<int>(index / m_columns);
+
+			for (const Neighbor& neighbor : NEIGHBORS)
+			{
+				const int nextColumn = column + neighbor.offset.x;
+				const int nextRow = row + neighbor.offset.y;
+				if (!isInside(nextColumn, nextRow)) continue;
+
+				const size_t next = toIndex(nextColumn, nextRow);
+				if (m_solid[next]) continue;
+
+				// 斜めは sample() と同じく、角を削らないよう両側が空いているときだけ進める
+				if (neighbor.offset.x != 0 && neighbor.offset.y != 0
+					&& (m_solid[toIndex(nextColumn, row)] || m_solid[toIndex(column, nextRow)])) continue;
+
+				const uint32 nextDistance = distance + neighbor.cost;
+				if (UNREACHED <= nextDistance || m_distances[next] <= nextDistance) continue;
+
+				m_distances[next] = static_cast<uint16>(nextDistance);
+				m_buckets[nextDistance % m_buckets.size()].push_back(static_cast<uint32>(next));
+				++pending;
+			}
+		}
+
+		bucket.clear();
+	}
+
+	m_isBuilt = true;
+}
+
+Optional<ChaseFieldSystem::Sample> ChaseFieldSystem::sample(const Vec2& position) const
+{
+	if (!m_isBuilt) return none;
+
+	const int column = static_cast<int>(Math::Floor(position.x / m_blockSize)) - m_minColumn;
+	const int row = static_cast<int>(Math::Floor(position.y / m_blockSize));
+	if (!isInside(column, row)) return none;
+
+	const uint16 distance = m_distances[toIndex(column, row)];
+	if (distance == UNREACHED) return none;
+
+	// 同じタイルにいれば直接向かう
+	if (distance == 0)
+	{
+		return Sample{ m_target, position.distanceFrom(m_target) };
+	}
+
+	// 周囲8タイルのうち最も距離の小さいタイルへ向かう（斜めは角を削らないよう両側が空いているときだけ）
+	int bestColumn = column;
+	int bestRow = row;
+	uint16 bestDistance = distance;
+
+	for (int dy = -1; dy <= 1; ++dy)
+	{
+		for (int dx = -1; dx <= 1; ++dx)
+		{
+			if (dx == 0 && dy == 0) continue;
+
+			const int nextColumn = column + dx;
+			const int nextRow = row + dy;
+			if (!isInside(nextColumn, nextRow)) continue;
+
+			if (dx != 0 && dy != 0
+				&& (m_solid[toIndex(column + dx, row)] || m_solid[toIndex(column, row + dy)])) continue;
+
+			const uint16 nextDistance = m_distances[toIndex(nextColumn, nextRow)];
+			if (nextDistance < bestDistance)
+			{
+				bestDistance = nextDistance;
+				bestColumn = nextColumn;
+				bestRow = nextRow;
+			}
+		}
+	}
+
+	const Vec2 waypoint = (bestDistance == 0)
+		? m_target
+		: Vec2((m_minColumn + bestColumn + 0.5) * m_blockSize, (bestRow + 0.5) * m_blockSize);
+
+	return Sample{ waypoint, distance * m_blockSize / STRAIGHT_COST };
+}
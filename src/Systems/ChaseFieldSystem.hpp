@@ -0,0 +1,49 @@
+﻿#pragma once
+#include <Siv3D.hpp>
+
+class Stage;
+
+// 追跡する敵が共有する、プレイヤーまでの経路の距離場
+// ティックごとに1回、指定した列の範囲の空きタイルをプレイヤーのタイルから8方向に探索する（敵の数によらず O(タイル数)）
+// 斜めの1手は縦横の 1.5 倍に数えるので、経路長と直線距離の差は数%以内に収まり、直線距離のしきい値とそのまま比べられる
+// 敵は自分のタイルより距離の小さい隣のタイルへ向かうことで、地形を回り込んで追跡する
+class ChaseFieldSystem
+{
+public:
+	struct Sample
+	{
+		Vec2 waypoint;        // 次に向かう位置
+		double pathDistance;  // sample() に渡した位置のタイルからプレイヤーまでの経路長（px）
+	};
+
+	// minColumn～maxColumn 列（タイル単位）の範囲で target までの距離場を作り直す
+	void build(const Stage& stage, const Vec2& target, int minColumn, int maxColumn);
+
+	// 範囲外のタイル・到達できないタイル・距離場を作っていないティックなら none
+	Optional<Sample> sample(const Vec2& position) const;
+
+	// このティックでは距離場を作らない（前のティックの距離場を参照させない）
+	void invalidate() { m_isBuilt = false; }
+
+	const Vec2& getTarget() const { return m_target; }
+
+private:
+	static constexpr uint16 UNREACHED = 0xFFFF;
+	static constexpr uint16 STRAIGHT_COST = 2;  // 縦横の1手（√2 ≒ 1.5 を整数で扱うため2倍にする）
+	static constexpr uint16 DIAGONAL_COST = 3;  // 斜めの1手
+
+	Vec2 m_target = Vec2::Zero();
+	double m_blockSize = 64.0;
+	int m_minColumn = 0;
+	int m_columns = 0;  // 範囲の列数
+	int m_rows = 0;
+	bool m_isBuilt = false;
+
+	// index = row * m_columns + (column - m_minColumn)
+	Array<uint16> m_distances;  // target のタイルからの距離（STRAIGHT_COST が1タイル）
+	Array<uint8> m_solid;
+	std::array<Array<uint32>, DIAGONAL_COST + 1> m_buckets;  // 距離ごとの探索キュー（容量を使い回す）
+
+	bool isInside(int localColumn, int row) const { return (0 <= localColumn && localColumn < m_columns && 0 <= row && row < m_rows); }
+	size_t toIndex(int localColumn, int row) const { return (static_cast<size_t>(row) * m_columns + localColumn); }
+};
@@ -1,5 +1,7 @@
 ﻿#include "CoinSystem.hpp"
+#include "../Core/FontRegistry.hpp"
 #include "../Sound/SoundManager.hpp"
+#include "../Core/SimulationClock.hpp"
 
 CoinSystem::CoinSystem()
 	: m_collectedCoinsCount(0)
@@ -14,8 +16,10 @@ void CoinSystem::init()
 
 void CoinSystem::loadTextures()
 {
+	m_textureLease.releaseAll();
+
 	// コインテクスチャを読み込み
-	m_coinTexture = Texture(U"Sprites/Tiles/hud_coin.png");
+	m_coinTexture = m_textureLease.acquire(U"Sprites/Tiles/hud_coin.png");
 
 	// きらめき効果用（オプション）
 	// m_sparkleTexture = Texture(U"Sprites/Effects/sparkle.png");
@@ -83,7 +87,7 @@ void CoinSystem::updateCoin(Coin& coin, const Vec2& playerPosition, const Vec2&
 
 	case CoinState::Collected:
 		// 収集アニメーション（ゆっくりと消え去りをかけて）
-		coin.attractTimer += Scene::DeltaTime();
+		coin.attractTimer += SimulationClock::DeltaTime();
 
 		// HUDに到達したかチェック（距離が十分近くなったら削除）
 		const double hudDistance = coin.position.distanceFrom(hudCoinPosition);
@@ -126,7 +130,7 @@ void CoinSystem::updateCoinPhysics(Coin& coin, const Vec2& hudCoinPosition)
 			// 加速的に移動（HUDに近づくほど速く）
 			const double speed = 15.0 * (1.0 + progress * 3.0);
 
-			coin.position += normalizedDir * speed * Scene::DeltaTime();
+			coin.position += normalizedDir * speed * SimulationClock::DeltaTime();
 		}
 
 		// フェードアウトと拡大効果
@@ -222,7 +226,7 @@ void CoinSystem::drawCoin(const Coin& coin, const Vec2& cameraOffset) const
 		const double hudDistance = coin.position.distanceFrom(hudWorldPos);
 
 		const String distanceText = U"Dist: {}"_fmt(static_cast<int>(hudDistance));
-		Font(16)(distanceText).draw(screenPos + Vec2(-30, -60), ColorF(1.0, 1.0, 0.0));
+		FontRegistry::Get(16)(distanceText).draw(screenPos + Vec2(-30, -60), ColorF(1.0, 1.0, 0.0));
 	}
 
 	// ワールド座標での方向ベクトルを表示
@@ -2,6 +2,7 @@
 #include <Siv3D.hpp>
 #include "../Player/Player.hpp"
 #include "../Stages/Stage.hpp"
+#include "../Core/TextureCache.hpp"
 class CoinSystem
 {
 public:
@@ -54,6 +55,7 @@ private:
 	// テクスチャ
 	Texture m_coinTexture;
 	Texture m_sparkleTexture; // きらめき効果用（オプション）
+	TextureLease m_textureLease;
 
 	// コイン管理
 	Array<std::unique_ptr<Coin>> m_coins;
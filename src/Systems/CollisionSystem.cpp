@@ -2,144 +2,102 @@
 #include "../Player/Player.hpp"
 #include "../Stages/Stage.hpp"
 #include "BlockSystem.hpp"
+#include "../Core/SimulationClock.hpp"
+
+template <class Visitor>
+bool CollisionSystem::forEachCollisionRectIn(const Stage* stage, const BlockSystem* blockSystem,
+											 const RectF& area, Visitor&& visitor) const
+{
+	// ステージのタイル → BlockSystemのブロックの順に走査
+	if (stage && !stage->forEachSolidRectIn(area, visitor))
+	{
+		return false;
+	}
+	if (blockSystem && !blockSystem->forEachSolidRectIn(area, visitor))
+	{
+		return false;
+	}
+	return true;
+}
 
 void CollisionSystem::resolvePlayerCollisions(Player* player, Stage* stage, BlockSystem* blockSystem)
 {
 	if (!player || !stage) return;
 
 	const Vec2 playerPos = player->getPosition();
-	Vec2 playerVel = player->getVelocity();
+	const Vec2 playerVel = player->getVelocity();
 
 	const double BLOCK_SIZE = 64.0;
 	const double PLAYER_SIZE = BLOCK_SIZE - 4.0; // プレイヤーを少し小さく（60x60）
 	const double halfSize = PLAYER_SIZE / 2.0;
 
-	// 次フレームの予測位置を計算
-	const double deltaTime = Scene::DeltaTime();
-	Vec2 nextPos = playerPos + playerVel * deltaTime;
+	// このティックの移動量
+	const double deltaTime = SimulationClock::DeltaTime();
+	const Vec2 displacement = playerVel * deltaTime;
 
-	// すべてのコリジョンレクトを統合
-	Array<RectF> allCollisionRects = getUnifiedCollisionRects(stage, blockSystem);
+	// 判定した矩形の数（デバッグ表示用）
+	size_t testedRectCount = 0;
 
 	bool isGrounded = false;
-	Vec2 finalPosition = nextPos;
 	Vec2 finalVelocity = playerVel;
+	RectF playerRect(playerPos.x - halfSize, playerPos.y - halfSize, PLAYER_SIZE, PLAYER_SIZE);
 
-	// ★ 改良: X軸とY軸を分離して処理（より自然な移動）
-	Vec2 intermediatePos = playerPos;
-
-	// 1. X軸方向の移動を先に処理
-	if (Math::Abs(playerVel.x) > 0.1)
+	// 0. ブロックの出現などで既にめり込んでいる場合は先に押し出す（押し出された向きと逆の速度は止める）
+	const Vec2 push = depenetrate(playerRect, stage, blockSystem, testedRectCount);
+	if (push.x * finalVelocity.x < 0.0)
+	{
+		finalVelocity.x = 0.0;
+	}
+	if (push.y * finalVelocity.y < 0.0)
+	{
+		finalVelocity.y = 0.0;
+	}
+	if (push.y < 0.0)
 	{
-		Vec2 xTargetPos = Vec2(nextPos.x, playerPos.y);
-		RectF xPlayerRect(xTargetPos.x - halfSize, xTargetPos.y - halfSize, PLAYER_SIZE, PLAYER_SIZE);
+		isGrounded = true;
+	}
+
+	// ★ 1ブロック以上動く場合はサブステップに分割（X→Yの順序による角のすり抜けを防ぐ）
+	const double maxDistance = Math::Max(Math::Abs(displacement.x), Math::Abs(displacement.y));
+	const int subSteps = Math::Max(static_cast<int>(Math::Ceil(maxDistance / MAX_SUBSTEP_DISTANCE)), 1);
+	const Vec2 stepDisplacement = displacement / subSteps;
 
-		bool xCollision = false;
-		for (const auto& blockRect : allCollisionRects)
+	for (int i = 0; i < subSteps; ++i)
+	{
+		// 1. X軸方向のスイープ（壁に当たったら以降のサブステップでは横に動かない）
+		if (finalVelocity.x != 0.0)
 		{
-			if (xPlayerRect.intersects(blockRect))
+			bool hit = false;
+			playerRect.x += sweepAxis(playerRect, stepDisplacement.x, true, stage, blockSystem, testedRectCount, hit);
+
+			if (hit)
 			{
-				// ★ 改良: 壁際での自然な停止
-				if (playerVel.x > 0)
-				{
-					// 右移動中の衝突
-					double wallX = blockRect.x - halfSize - 0.5;
-					intermediatePos.x = wallX;
-				}
-				else
-				{
-					// 左移動中の衝突  
-					double wallX = blockRect.x + blockRect.w + halfSize + 0.5;
-					intermediatePos.x = wallX;
-				}
-
-				// ★ 重要: 壁に当たった時の速度処理を改良
 				finalVelocity.x = 0.0;
-				xCollision = true;
-				break;
 			}
 		}
 
-		if (!xCollision)
+		// 2. Y軸方向のスイープ
+		if (finalVelocity.y != 0.0)
 		{
-			intermediatePos.x = xTargetPos.x;
-		}
-	}
-	else
-	{
-		intermediatePos.x = nextPos.x;
-	}
-
-	// 2. Y軸方向の移動を処理
-	if (Math::Abs(playerVel.y) > 0.1)
-	{
-		Vec2 yTargetPos = Vec2(intermediatePos.x, nextPos.y);
-		RectF yPlayerRect(yTargetPos.x - halfSize, yTargetPos.y - halfSize, PLAYER_SIZE, PLAYER_SIZE);
+			bool hit = false;
+			playerRect.y += sweepAxis(playerRect, stepDisplacement.y, false, stage, blockSystem, testedRectCount, hit);
 
-		bool yCollision = false;
-		for (const auto& blockRect : allCollisionRects)
-		{
-			if (yPlayerRect.intersects(blockRect))
+			if (hit)
 			{
-				// Y軸衝突の処理
-				if (playerVel.y > 0)
-				{
-					// 下移動中の衝突（着地）
-					intermediatePos.y = blockRect.y - halfSize - 0.5;
-					isGrounded = true;
-				}
-				else
-				{
-					// 上移動中の衝突（天井）
-					intermediatePos.y = blockRect.y + blockRect.h + halfSize + 0.5;
-				}
+				// 下移動中なら着地、上移動中なら天井
+				isGrounded = (stepDisplacement.y > 0.0);
 				finalVelocity.y = 0.0;
-				yCollision = true;
-				break;
 			}
 		}
-
-		if (!yCollision)
-		{
-			intermediatePos.y = yTargetPos.y;
-		}
-	}
-	else
-	{
-		intermediatePos.y = nextPos.y;
 	}
 
-	finalPosition = intermediatePos;
+	const Vec2 finalPosition = playerRect.center();
 
 	// 改良された接地判定
 	if (!isGrounded)
 	{
-		isGrounded = checkPreciseGroundContact(finalPosition, allCollisionRects);
-	}
-
-	// ★ 追加: 壁際でのスタック防止
-	// 連続して同じ位置にいる場合は少し押し出す
-	static Vec2 previousPos = finalPosition;
-	static int stuckCounter = 0;
-
-	if (finalPosition.distanceFrom(previousPos) < 0.5)
-	{
-		stuckCounter++;
-		if (stuckCounter > 5) // 5フレーム連続で同じ位置
-		{
-			// わずかに押し出す
-			if (Math::Abs(playerVel.x) > Math::Abs(playerVel.y))
-			{
-				finalPosition.x += (playerVel.x > 0) ? -1.0 : 1.0;
-			}
-			stuckCounter = 0;
-		}
-	}
-	else
-	{
-		stuckCounter = 0;
+		isGrounded = checkPreciseGroundContact(finalPosition, stage, blockSystem);
 	}
-	previousPos = finalPosition;
 
 	// プレイヤーの状態を更新
 	player->setPosition(finalPosition);
@@ -147,10 +105,93 @@ void CollisionSystem::resolvePlayerCollisions(Player* player, Stage* stage, Bloc
 	player->setGrounded(isGrounded);
 
 #ifdef _DEBUG
-	debugCollisionInfo(finalPosition, finalVelocity, isGrounded, allCollisionRects.size());
+	debugCollisionInfo(finalPosition, finalVelocity, isGrounded, testedRectCount);
 #endif
 }
 
+Vec2 CollisionSystem::depenetrate(RectF& box, const Stage* stage, const BlockSystem* blockSystem,
+								  size_t& testedRectCount) const
+{
+	Vec2 totalPush{ 0.0, 0.0 };
+
+	for (int iteration = 0; iteration < MAX_DEPENETRATION_ITERATIONS; ++iteration)
+	{
+		// 最も深く重なっている矩形から解消する（押し出した先で別の矩形と重なれば次の反復で解消する）
+		Vec2 push{ 0.0, 0.0 };
+
+		forEachCollisionRectIn(stage, blockSystem, box, [&](const RectF& rect) {
+			++testedRectCount;
+
+			const double toLeft = box.rightX() - rect.x;
+			const double toRight = rect.rightX() - box.x;
+			const double toUp = box.bottomY() - rect.y;
+			const double toDown = rect.bottomY() - box.y;
+
+			// 接しているだけの矩形は押し出さない
+			if (toLeft <= 0.0 || toRight <= 0.0 || toUp <= 0.0 || toDown <= 0.0) return true;
+
+			const double pushX = (toLeft < toRight) ? -(toLeft + CONTACT_GAP) : (toRight + CONTACT_GAP);
+			const double pushY = (toUp < toDown) ? -(toUp + CONTACT_GAP) : (toDown + CONTACT_GAP);
+			const Vec2 candidate = (Math::Abs(pushX) < Math::Abs(pushY)) ? Vec2{ pushX, 0.0 } : Vec2{ 0.0, pushY };
+
+			if (push.lengthSq() < candidate.lengthSq())
+			{
+				push = candidate;
+			}
+			return true;
+		});
+
+		if (push.isZero()) break;
+
+		box.moveBy(push);
+		totalPush += push;
+	}
+
+	return totalPush;
+}
+
+double CollisionSystem::sweepAxis(const RectF& box, double delta, bool horizontal,
+								  const Stage* stage, const BlockSystem* blockSystem,
+								  size_t& testedRectCount, bool& hit) const
+{
+	hit = false;
+	if (delta == 0.0) return 0.0;
+
+	const double boxMin = horizontal ? box.x : box.y;
+	const double boxSize = horizontal ? box.w : box.h;
+	const double leadingEdge = (delta > 0.0) ? (boxMin + boxSize) : boxMin;
+
+	// 移動経路（開始位置から移動先＋隙間まで）を覆う範囲
+	const double reach = Math::Abs(delta) + CONTACT_GAP;
+	const RectF sweptArea = horizontal
+		? RectF((delta > 0.0) ? box.x : box.x - reach, box.y, box.w + reach, box.h)
+		: RectF(box.x, (delta > 0.0) ? box.y : box.y - reach, box.w, box.h + reach);
+
+	// 移動方向の手前側の面までの距離が最小のものが最初の衝突（time of impact = allowed / |delta|）
+	double allowed = Math::Abs(delta);
+
+	forEachCollisionRectIn(stage, blockSystem, sweptArea, [&](const RectF& rect) {
+		++testedRectCount;
+
+		const double rectMin = horizontal ? rect.x : rect.y;
+		const double rectSize = horizontal ? rect.w : rect.h;
+		const double distance = (delta > 0.0) ? (rectMin - leadingEdge) : (leadingEdge - (rectMin + rectSize));
+
+		// 背後の矩形（重なりは depenetrate() で解消済み）は移動を妨げない
+		if (distance < -CONTACT_GAP) return true;
+
+		const double limit = Math::Max(distance - CONTACT_GAP, 0.0);
+		if (limit < allowed)
+		{
+			allowed = limit;
+			hit = true;
+		}
+		return true;
+	});
+
+	return (delta > 0.0) ? allowed : -allowed;
+}
+
 CollisionSystem::CollisionResult CollisionSystem::resolveBlockCollision(
 	const Vec2& currentPos, const Vec2& nextPos, const Vec2& velocity, const RectF& blockRect)
 {
@@ -223,26 +264,27 @@ CollisionSystem::CollisionResult CollisionSystem::resolveBlockCollision(
 
 Array<RectF> CollisionSystem::getUnifiedCollisionRects(Stage* stage, BlockSystem* blockSystem) const
 {
+	// 互換用：更新処理では forEachCollisionRectIn() による範囲走査を使う
 	Array<RectF> allRects;
 
 	// ステージの衝突矩形を追加
 	if (stage)
 	{
 		const Array<RectF> stageRects = stage->getCollisionRects();
-		allRects.append(stageRects);
+		allRects.insert(allRects.end(), stageRects.begin(), stageRects.end());
 	}
 
 	// BlockSystemの衝突矩形を追加
 	if (blockSystem)
 	{
 		const Array<RectF> blockRects = blockSystem->getCollisionRects();
-		allRects.append(blockRects);
+		allRects.insert(allRects.end(), blockRects.begin(), blockRects.end());
 	}
 
 	return allRects;
 }
 
-bool CollisionSystem::checkPreciseGroundContact(const Vec2& playerPos, const Array<RectF>& terrainRects) const
+RectF CollisionSystem::getGroundCheckRect(const Vec2& playerPos) const
 {
 	const double PLAYER_SIZE = 64.0 - 4.0; // 60x60
 	const double halfSize = PLAYER_SIZE / 2.0;
@@ -250,41 +292,66 @@ bool CollisionSystem::checkPreciseGroundContact(const Vec2& playerPos, const Arr
 
 	// プレイヤーの足元の矩形（中央部分のみ）
 	const double footMargin = 4.0;
-	RectF groundCheckRect(
+	return RectF(
 		playerPos.x - halfSize + footMargin,
 		playerPos.y + halfSize,
 		PLAYER_SIZE - footMargin * 2,
 		GROUND_CHECK_HEIGHT
 	);
+}
 
+bool CollisionSystem::isGroundContact(const Vec2& playerPos, const RectF& terrainRect) const
+{
+	const double PLAYER_SIZE = 64.0 - 4.0; // 60x60
+	const double halfSize = PLAYER_SIZE / 2.0;
+	const double GROUND_CHECK_HEIGHT = 2.0;
+	const double footMargin = 4.0;
+
+	if (!getGroundCheckRect(playerPos).intersects(terrainRect))
+	{
+		return false;
+	}
+
+	// プレイヤーの足がブロックの上面に接触しているか確認
+	double playerBottom = playerPos.y + halfSize;
+	double blockTop = terrainRect.y;
+
+	if (Math::Abs(playerBottom - blockTop) > GROUND_CHECK_HEIGHT)
+	{
+		return false;
+	}
+
+	// 水平方向の重複も確認
+	double playerLeft = playerPos.x - halfSize + footMargin;
+	double playerRight = playerPos.x + halfSize - footMargin;
+	double blockLeft = terrainRect.x;
+	double blockRight = terrainRect.x + terrainRect.w;
+
+	// 最小限の重複があれば接地
+	return (playerRight > blockLeft + 2.0 && playerLeft < blockRight - 2.0);
+}
+
+bool CollisionSystem::checkPreciseGroundContact(const Vec2& playerPos, std::span<const RectF> terrainRects) const
+{
 	for (const auto& terrainRect : terrainRects)
 	{
-		if (groundCheckRect.intersects(terrainRect))
+		if (isGroundContact(playerPos, terrainRect))
 		{
-			// プレイヤーの足がブロックの上面に接触しているか確認
-			double playerBottom = playerPos.y + halfSize;
-			double blockTop = terrainRect.y;
-
-			if (Math::Abs(playerBottom - blockTop) <= GROUND_CHECK_HEIGHT)
-			{
-				// 水平方向の重複も確認
-				double playerLeft = playerPos.x - halfSize + footMargin;
-				double playerRight = playerPos.x + halfSize - footMargin;
-				double blockLeft = terrainRect.x;
-				double blockRight = terrainRect.x + terrainRect.w;
-
-				// 最小限の重複があれば接地
-				if (playerRight > blockLeft + 2.0 && playerLeft < blockRight - 2.0)
-				{
-					return true;
-				}
-			}
+			return true;
 		}
 	}
 	return false;
 }
 
-bool CollisionSystem::canPlayerFitInGap(const Vec2& position, const Array<RectF>& terrainRects) const
+bool CollisionSystem::checkPreciseGroundContact(const Vec2& playerPos, const Stage* stage, const BlockSystem* blockSystem) const
+{
+	// 足元と重なる矩形だけを走査し、接地が見つかった時点で打ち切る
+	return !forEachCollisionRectIn(stage, blockSystem, getGroundCheckRect(playerPos), [&](const RectF& terrainRect) {
+		return !isGroundContact(playerPos, terrainRect);
+	});
+}
+
+bool CollisionSystem::canPlayerFitInGap(const Vec2& position, std::span<const RectF> terrainRects) const
 {
 	const double BLOCK_SIZE = 64.0;
 	const double halfSize = BLOCK_SIZE / 2.0;
@@ -321,7 +388,7 @@ RectF CollisionSystem::getPlayerRect(const Vec2& position, const Vec2& size) con
 	return RectF(position.x - halfSize, position.y - halfSize, BLOCK_SIZE, BLOCK_SIZE);
 }
 
-Vec2 CollisionSystem::findNearestGroundPosition(const Vec2& position, const Array<RectF>& terrainRects) const
+Vec2 CollisionSystem::findNearestGroundPosition(const Vec2& position, std::span<const RectF> terrainRects) const
 {
 	const double BLOCK_SIZE = 64.0;
 	const double halfSize = BLOCK_SIZE / 2.0;
@@ -363,21 +430,21 @@ Vec2 CollisionSystem::findNearestGroundPosition(const Vec2& position, const Arra
 }
 
 bool CollisionSystem::checkImprovedGroundContact(const Vec2& playerPos, const Vec2& playerSize,
-											   const Array<RectF>& terrainRects) const
+											   std::span<const RectF> terrainRects) const
 {
 	// 新システムでは playerSize パラメータを無視
 	return checkPreciseGroundContact(playerPos, terrainRects);
 }
 
 bool CollisionSystem::checkGroundContact(const Vec2& playerPos, const Vec2& playerSize,
-									   const Array<RectF>& terrainRects) const
+									   std::span<const RectF> terrainRects) const
 {
 	// 新システムでは playerSize パラメータを無視
 	return checkPreciseGroundContact(playerPos, terrainRects);
 }
 
 void CollisionSystem::checkSlidingBlockCollision(Player* player, const Vec2& playerPos, const Vec2& playerSize,
-												const Array<RectF>& blockRects, BlockSystem* blockSystem) const
+												std::span<const RectF> blockRects, BlockSystem* blockSystem) const
 {
 	if (!player || !blockSystem) return;
 
@@ -405,7 +472,7 @@ void CollisionSystem::checkSlidingBlockCollision(Player* player, const Vec2& pla
 
 #ifdef _DEBUG
 void CollisionSystem::debugCollisionInfo(const Vec2& position, const Vec2& velocity,
-										bool grounded, size_t blockCount) const
+										bool grounded, size_t testedRectCount) const
 {
 	static int debugCounter = 0;
 	if (debugCounter++ % 120 == 0) // 2秒ごと
@@ -414,7 +481,7 @@ void CollisionSystem::debugCollisionInfo(const Vec2& position, const Vec2& veloc
 		Print << U"Position: ({:.1f}, {:.1f})"_fmt(position.x, position.y);
 		Print << U"Velocity: ({:.1f}, {:.1f})"_fmt(velocity.x, velocity.y);
 		Print << U"Grounded: " << (grounded ? U"YES" : U"NO");
-		Print << U"Block count: " << blockCount;
+		Print << U"Tested rects: " << testedRectCount;
 
 		// グリッド位置表示
 		const double BLOCK_SIZE = 64.0;
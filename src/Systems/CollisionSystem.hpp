@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
+#include <span>
 
 // 前方宣言
 class Player;
@@ -44,37 +45,59 @@ public:
 	CollisionResult resolveBlockCollision(const Vec2& currentPos, const Vec2& nextPos,
 										 const Vec2& velocity, const RectF& blockRect);
 
-	// ★ 統合衝突矩形取得
+	// ★ 統合衝突矩形取得（互換用）
 	Array<RectF> getUnifiedCollisionRects(Stage* stage, BlockSystem* blockSystem) const;
 
 	// ★ 精密な接地判定（1ブロック基準）
-	bool checkPreciseGroundContact(const Vec2& playerPos, const Array<RectF>& terrainRects) const;
+	bool checkPreciseGroundContact(const Vec2& playerPos, std::span<const RectF> terrainRects) const;
+	bool checkPreciseGroundContact(const Vec2& playerPos, const Stage* stage, const BlockSystem* blockSystem) const;
 
 	// ★ プレイヤーが隙間に入れるかチェック
-	bool canPlayerFitInGap(const Vec2& position, const Array<RectF>& terrainRects) const;
+	bool canPlayerFitInGap(const Vec2& position, std::span<const RectF> terrainRects) const;
 
 	// スライディング時の特別判定
 	void checkSlidingBlockCollision(Player* player, const Vec2& playerPos, const Vec2& playerSize,
-								   const Array<RectF>& blockRects, BlockSystem* blockSystem) const;
+								   std::span<const RectF> blockRects, BlockSystem* blockSystem) const;
 
 	// ユーティリティメソッド
 	RectF getPlayerRect(const Vec2& position, const Vec2& size = Vec2::Zero()) const;
-	Vec2 findNearestGroundPosition(const Vec2& position, const Array<RectF>& terrainRects) const;
+	Vec2 findNearestGroundPosition(const Vec2& position, std::span<const RectF> terrainRects) const;
 
 	// レガシー互換メソッド（段階的に削除予定）
 	bool checkImprovedGroundContact(const Vec2& playerPos, const Vec2& playerSize,
-								   const Array<RectF>& terrainRects) const;
+								   std::span<const RectF> terrainRects) const;
 	bool checkGroundContact(const Vec2& playerPos, const Vec2& playerSize,
-						   const Array<RectF>& terrainRects) const;
+						   std::span<const RectF> terrainRects) const;
 
 private:
 	// 定数（64x64ブロック基準）
 	static constexpr double COLLISION_EPSILON = 0.1;
 	static constexpr double SEPARATION_OFFSET = 1.0;
+	static constexpr double CONTACT_GAP = 0.5;             // 衝突時に壁・床との間に残す隙間
+	static constexpr double MAX_SUBSTEP_DISTANCE = 64.0;   // 1サブステップの最大移動量（1ブロック）
+	static constexpr int MAX_DEPENETRATION_ITERATIONS = 4;  // 重なりの押し出しを繰り返す上限
+
+	// 指定範囲と重なるステージ・ブロックの固体矩形を visitor に渡す（メモリ確保なし）
+	template <class Visitor>
+	bool forEachCollisionRectIn(const Stage* stage, const BlockSystem* blockSystem,
+								const RectF& area, Visitor&& visitor) const;
+
+	// 1軸方向のスイープ判定：最初に当たる矩形の手前までの移動量（符号付き）を返す
+	double sweepAxis(const RectF& box, double delta, bool horizontal,
+					 const Stage* stage, const BlockSystem* blockSystem,
+					 size_t& testedRectCount, bool& hit) const;
+
+	// 既に重なっている矩形から、重なりが浅い軸の向きへ押し出す。押し出した量の合計を返す
+	Vec2 depenetrate(RectF& box, const Stage* stage, const BlockSystem* blockSystem,
+					 size_t& testedRectCount) const;
+
+	// 足元の矩形が地面として接触しているか
+	bool isGroundContact(const Vec2& playerPos, const RectF& terrainRect) const;
+	RectF getGroundCheckRect(const Vec2& playerPos) const;
 
 #ifdef _DEBUG
 	// デバッグ用メソッド
 	void debugCollisionInfo(const Vec2& position, const Vec2& velocity,
-						   bool grounded, size_t blockCount) const;
+						   bool grounded, size_t testedRectCount) const;
 #endif
 };
@@ -1,4 +1,6 @@
 ﻿#include "DayNightSystem.hpp"
+#include "../Core/SimulationClock.hpp"
+#include <array>
 
 DayNightSystem::DayNightSystem()
 	: m_currentTime(0.0)
@@ -15,16 +17,11 @@ DayNightSystem::DayNightSystem()
 
 void DayNightSystem::init()
 {
-	m_dayNightShader = HLSL(U"Shaders/DayNight.hlsl", U"PS");
-	if (!m_dayNightShader)
-	{
-		Print << U"Failed to load DayNight shader";
-	}
-
-	m_shaderParams = ConstantBuffer<DayNightParams>();
+	m_shaderParams = DayNightParams{};
 
 	// BlackFireテクスチャの読み込み
-	m_blackFireTexture = Texture(U"Sprites/BlackFire.png");
+	m_textureLease.releaseAll();
+	m_blackFireTexture = m_textureLease.acquire(U"Sprites/BlackFire.png");
 	if (!m_blackFireTexture)
 	{
 		Print << U"Failed to load BlackFire texture";
@@ -34,11 +31,29 @@ void DayNightSystem::init()
 	// m_gaugeTexture = Texture(U"UI/MNGage.png"); // 削除
 
 	// UI用フォント初期化
-	m_uiFont = Font(20, Typeface::Bold);
-	m_smallFont = Font(16);
+	m_uiFont = FontRegistry::Get(20, Typeface::Bold);
+	m_smallFont = FontRegistry::Get(16);
+
+	static constexpr std::array<StringView, 3> phaseLabels = { U"Sunset", U"Night", U"Dawn" };
+	for (size_t i = 0; i < phaseLabels.size(); ++i)
+	{
+		m_phaseLabelTexts[i] = CachedText{ FontRegistry::Get(12) };
+		m_phaseLabelTexts[i].set(phaseLabels[i]);
+	}
+	m_nightWarningText = CachedText{ m_smallFont };
+	m_nightWarningText.set(U"DANGEROUS NIGHT!");
+	for (size_t i = 0; i < m_phaseTexts.size(); ++i)
+	{
+		m_phaseTexts[i] = CachedText{ m_uiFont };
+		m_phaseTexts[i].set(GetPhaseText(static_cast<TimePhase>(i)));
+	}
+	m_untilNightText = GlyphText{ m_smallFont };
+	m_bonusText = CachedText{ FontRegistry::Get(14) };
+	m_bonusStars = -1;
 
-	// 変身エフェクト配列の初期化
+	// 変身エフェクト配列の初期化（夜になった瞬間にまとめて積まれるので先に確保しておく）
 	m_transformEffects.clear();
+	m_transformEffects.reserve(32);
 	m_previousPhase = TimePhase::Day;
 	m_justBecameNight = false;
 
@@ -51,7 +66,7 @@ void DayNightSystem::update()
 {
 	if (m_isPaused) return;
 
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 	m_currentTime += deltaTime * m_timeSpeed;
 
 	if (m_currentTime >= m_dayDuration)
@@ -68,17 +83,12 @@ void DayNightSystem::update()
 	updateTransformEffects();
 }
 
-void DayNightSystem::applyShader(const RenderTexture& source) const
+void DayNightSystem::writePostProcessParams(PostProcessChain::FusedParams& params) const
 {
-	if (!m_dayNightShader)
-	{
-		source.draw();
-		return;
-	}
-
-	Graphics2D::SetConstantBuffer(ShaderStage::Pixel, 1, m_shaderParams);
-	const ScopedCustomShader2D shader(m_dayNightShader);
-	source.draw();
+	params.timeOfDay = m_shaderParams.timeOfDay;
+	params.moonlightIntensity = m_shaderParams.moonlightIntensity;
+	params.phaseBlend = m_shaderParams.phaseBlend;
+	params.starsBonus = m_shaderParams.starsBonus;
 }
 
 void DayNightSystem::onStarCollected()
@@ -138,7 +148,7 @@ void DayNightSystem::updatePhase()
 }
 void DayNightSystem::updatePhaseTransition()
 {
-	m_phaseTransitionTimer += Scene::DeltaTime();
+	m_phaseTransitionTimer += SimulationClock::DeltaTime();
 	const double transitionDuration = 2.0;
 	m_phaseTransitionTimer = Min(m_phaseTransitionTimer, transitionDuration);
 }
@@ -163,10 +173,10 @@ void DayNightSystem::updateEnemyAggression()
 void DayNightSystem::updateShaderParams()
 {
 	const double normalizedTime = m_currentTime / m_dayDuration;
-	m_shaderParams->timeOfDay = static_cast<float>(normalizedTime);
-	m_shaderParams->moonlightIntensity = static_cast<float>(calculateMoonlight());
-	m_shaderParams->phaseBlend = static_cast<float>(m_phaseTransitionTimer / 2.0);
-	m_shaderParams->starsBonus = static_cast<float>(m_starsCollected * 0.1);
+	m_shaderParams.timeOfDay = static_cast<float>(normalizedTime);
+	m_shaderParams.moonlightIntensity = static_cast<float>(calculateMoonlight());
+	m_shaderParams.phaseBlend = static_cast<float>(m_phaseTransitionTimer / 2.0);
+	m_shaderParams.starsBonus = static_cast<float>(m_starsCollected * 0.1);
 }
 
 double DayNightSystem::calculateMoonlight() const
@@ -254,9 +264,14 @@ double DayNightSystem::getTimeUntilNight() const
 	return (1.0 - normalizedTime + nightStartNormalized) * m_dayDuration;
 }
 
-String DayNightSystem::getPhaseText() const
+StringView DayNightSystem::getPhaseText() const
 {
-	switch (m_currentPhase)
+	return GetPhaseText(m_currentPhase);
+}
+
+StringView DayNightSystem::GetPhaseText(TimePhase phase)
+{
+	switch (phase)
 	{
 	case TimePhase::Day:
 		return U"DAY TIME - Safe";
@@ -292,7 +307,7 @@ ColorF DayNightSystem::getPhaseColor() const
 void DayNightSystem::drawTimeGaugeUI(const Vec2& position) const
 {
 	const Vec2 gaugePos = position;
-	const Size gaugeSize(200, 24);
+	const Size gaugeSize(TIME_GAUGE_WIDTH, TIME_GAUGE_HEIGHT);
 	const double normalizedTime = m_currentTime / m_dayDuration;
 
 	// 背景フレーム描画
@@ -340,8 +355,7 @@ void DayNightSystem::drawTimeGaugeUI(const Vec2& position) const
 	}
 
 	// 時間帯区切り線を描画
-	const Array<double> phaseMarkers = { 0.5, 0.65, 0.85 };
-	const Array<String> phaseLabels = { U"Sunset", U"Night", U"Dawn" };
+	static constexpr std::array<double, 3> phaseMarkers = { 0.5, 0.65, 0.85 };
 
 	for (size_t i = 0; i < phaseMarkers.size(); ++i)
 	{
@@ -350,22 +364,41 @@ void DayNightSystem::drawTimeGaugeUI(const Vec2& position) const
 			.draw(2.0, ColorF(1.0, 1.0, 1.0, 0.7));
 
 		// テキストラベル描画
-		Font(12)(phaseLabels[i]).drawAt(markerX, gaugePos.y - 15, ColorF(1.0, 1.0, 1.0));
+		m_phaseLabelTexts[i].get().drawAt(markerX, gaugePos.y - 15, ColorF(1.0, 1.0, 1.0));
 	}
 
 	// 現在位置のインジケーター
 	const double indicatorX = gaugePos.x + gaugeSize.x * normalizedTime;
 
 	// ダイヤモンド型インジケーター
-	const Array<Vec2> diamond = {
+	const Quad diamond{
 		Vec2(indicatorX, gaugePos.y - 8),
 		Vec2(indicatorX + 6, gaugePos.y - 2),
 		Vec2(indicatorX, gaugePos.y + 4),
 		Vec2(indicatorX - 6, gaugePos.y - 2)
 	};
 
-	Polygon(diamond).draw(ColorF(1.0, 1.0, 1.0, 0.9));
-	Polygon(diamond).drawFrame(2.0, getPhaseColor());
+	diamond.draw(ColorF(1.0, 1.0, 1.0, 0.9));
+	diamond.drawFrame(2.0, getPhaseColor());
+}
+
+DayNightSystem::TimeUIState DayNightSystem::getTimeUIState() const
+{
+	return TimeUIState{
+		m_currentPhase,
+		static_cast<int>(TIME_GAUGE_WIDTH * getNormalizedTime()),
+		static_cast<int>(getTimeUntilNight())
+	};
+}
+
+bool DayNightSystem::isTimeUIAnimating() const
+{
+	const double timeUntilNight = getTimeUntilNight();
+	if (timeUntilNight > 0.0)
+	{
+		return (timeUntilNight < 30.0);
+	}
+	return isNight();
 }
 
 void DayNightSystem::drawTimeInfoUI(const Vec2& position) const
@@ -373,27 +406,26 @@ void DayNightSystem::drawTimeInfoUI(const Vec2& position) const
 	const Vec2 infoPos = position;
 
 	// フェーズテキストの描画
-	const String phaseText = getPhaseText();
+	const DrawableText& phaseText = m_phaseTexts[static_cast<size_t>(m_currentPhase)].get();
 	const ColorF phaseColor = getPhaseColor();
 
 	// 背景ボックス
-	const SizeF textSize = m_uiFont(phaseText).region().size;
+	const SizeF textSize = phaseText.region().size;
 	RectF(infoPos.x - 10, infoPos.y - 5, textSize.x + 20, textSize.y + 10)
 		.draw(ColorF(0.0, 0.0, 0.0, 0.6));
 
-	m_uiFont(phaseText).draw(infoPos, phaseColor);
+	phaseText.draw(infoPos, phaseColor);
 
 	// 夜までの残り時間表示
 	const double timeUntilNight = getTimeUntilNight();
 
 	if (timeUntilNight > 0.0)
 	{
-		const int minutes = static_cast<int>(timeUntilNight / 60.0);
-		const int seconds = static_cast<int>(timeUntilNight) % 60;
-		const String timeText = U"Until Night: {}:{:02d}"_fmt(minutes, seconds);
+		const int totalSeconds = static_cast<int>(timeUntilNight);
+		m_untilNightText.clear().append(U"Until Night: ").append(totalSeconds / 60).append(U":").append(totalSeconds % 60, 2);
 
 		const Vec2 timeTextPos(infoPos.x, infoPos.y + 30);
-		const SizeF timeTextSize = m_smallFont(timeText).region().size;
+		const SizeF timeTextSize = m_untilNightText.size();
 
 		// 時間表示の背景
 		RectF(timeTextPos.x - 5, timeTextPos.y - 3, timeTextSize.x + 10, timeTextSize.y + 6)
@@ -413,39 +445,44 @@ void DayNightSystem::drawTimeInfoUI(const Vec2& position) const
 			timeColor = ColorF(1.0, 0.7, 0.3);
 		}
 
-		m_smallFont(timeText).draw(timeTextPos, timeColor);
+		m_untilNightText.draw(timeTextPos, timeColor);
 	}
 	else if (isNight())
 	{
 		// 夜の間は警告メッセージ
-		const String warningText = U"DANGEROUS NIGHT!";
+		const DrawableText& warningText = m_nightWarningText.get();
 		const Vec2 warningPos(infoPos.x, infoPos.y + 30);
 
 		const double pulse = std::sin(Scene::Time() * 4.0) * 0.3 + 0.7;
 		const ColorF warningColor(1.0, 0.2, 0.2, pulse);
 
-		const SizeF warningSize = m_smallFont(warningText).region().size;
+		const SizeF warningSize = warningText.region().size;
 		RectF(warningPos.x - 5, warningPos.y - 3, warningSize.x + 10, warningSize.y + 6)
 			.draw(ColorF(0.2, 0.0, 0.0, pulse * 0.5));
 
-		m_smallFont(warningText).draw(warningPos, warningColor);
+		warningText.draw(warningPos, warningColor);
 	}
 
 	// スターボーナス表示
 	if (m_starsCollected > 0)
 	{
-		const String bonusText = U"Stars x{} Time Extension: +{}sec"_fmt(
-			m_starsCollected,
-			static_cast<int>(m_starsCollected * STAR_TIME_BONUS)
-		);
+		if (m_starsCollected != m_bonusStars)
+		{
+			m_bonusText.set(U"Stars x{} Time Extension: +{}sec"_fmt(
+				m_starsCollected,
+				static_cast<int>(m_starsCollected * STAR_TIME_BONUS)
+			));
+			m_bonusStars = m_starsCollected;
+		}
+		const DrawableText& bonusText = m_bonusText.get();
 
 		const Vec2 bonusPos(infoPos.x, infoPos.y + 55);
-		const SizeF bonusSize = Font(14)(bonusText).region().size;
+		const SizeF bonusSize = bonusText.region().size;
 
 		RectF(bonusPos.x - 3, bonusPos.y - 2, bonusSize.x + 6, bonusSize.y + 4)
 			.draw(ColorF(0.0, 0.0, 0.0, 0.4));
 
-		Font(14)(bonusText).draw(bonusPos, ColorF(1.0, 1.0, 0.5));
+		bonusText.draw(bonusPos, ColorF(1.0, 1.0, 0.5));
 	}
 }
 
@@ -464,7 +501,7 @@ void DayNightSystem::triggerTransformEffect(const Vec2& position)
 
 void DayNightSystem::updateTransformEffects()
 {
-	const double deltaTime = Scene::DeltaTime();
+	const double deltaTime = SimulationClock::DeltaTime();
 
 	for (auto it = m_transformEffects.begin(); it != m_transformEffects.end();)
 	{
@@ -1,5 +1,8 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
+#include "../Core/TextureCache.hpp"
+#include "../Core/FontRegistry.hpp"
+#include "../Effects/PostProcessChain.hpp"
 
 class DayNightSystem
 {
@@ -23,26 +26,35 @@ private:
 	double m_phaseTransitionTimer;
 	double m_enemyAggressionLevel;
 
-	// シェーダー関連
-	PixelShader m_dayNightShader;
+	// シェーダー関連（PostProcess.hlsl の昼夜の処理に渡す値）
 	struct DayNightParams
 	{
-		float timeOfDay;
-		float moonlightIntensity;
-		float phaseBlend;
-		float starsBonus;
+		float timeOfDay = 0.0f;
+		float moonlightIntensity = 0.0f;
+		float phaseBlend = 0.0f;
+		float starsBonus = 0.0f;
 	};
-	ConstantBuffer<DayNightParams> m_shaderParams;
+	DayNightParams m_shaderParams;
 
 	//  UI関連メンバー
 	Texture m_gaugeTexture;
 	Font m_uiFont;
 	Font m_smallFont;
 
+	// UI の文字列は init() で組んでおく（font(text) は呼ぶたびに確保するため）
+	std::array<CachedText, 3> m_phaseLabelTexts;
+	std::array<CachedText, 4> m_phaseTexts;  // TimePhase の順
+	CachedText m_nightWarningText;
+	mutable GlyphText m_untilNightText;
+	mutable CachedText m_bonusText;
+	mutable int m_bonusStars = -1;         // m_bonusText に組んであるスター数
+
 	// 定数
 	static constexpr double BASE_DAY_DURATION = 60.0;
 	static constexpr double STAR_TIME_BONUS = 10.0;
 	static constexpr double STAR_NIGHT_DELAY = 5.0;
+	static constexpr int TIME_GAUGE_WIDTH = 200;
+	static constexpr int TIME_GAUGE_HEIGHT = 24;
 
 	// 変身エフェクト関連
 	struct TransformEffect {
@@ -55,6 +67,7 @@ private:
 	};
 	Array<TransformEffect> m_transformEffects;
 	Texture m_blackFireTexture;
+	TextureLease m_textureLease;
 	static constexpr double TRANSFORM_FRAME_DURATION = 0.05; // 各フレーム0.05秒
 	static constexpr int BLACKFIRE_FRAMES = 16;
 	static constexpr int BLACKFIRE_SPRITE_SIZE = 128;
@@ -68,7 +81,7 @@ public:
 
 	void init();
 	void update();
-	void applyShader(const RenderTexture& source) const;
+	void writePostProcessParams(PostProcessChain::FusedParams& params) const;
 
 	// スター収集による時間制御
 	void onStarCollected();
@@ -95,13 +108,27 @@ public:
 
 	// 環境効果
 	ColorF getAmbientLight() const;
-	String getPhaseText() const;
+	StringView getPhaseText() const;
 	ColorF getPhaseColor() const;
 
 	// UI描画メソッド
 	void drawTimeGaugeUI(const Vec2& position) const;
 	void drawTimeInfoUI(const Vec2& position) const;
 
+	// 時間表示UIの内容を決める値（ゲージはピクセル単位、残り時間は秒単位）
+	struct TimeUIState
+	{
+		TimePhase phase = TimePhase::Day;
+		int indicatorPixel = 0;
+		int secondsUntilNight = 0;
+
+		bool operator==(const TimeUIState&) const = default;
+	};
+	TimeUIState getTimeUIState() const;
+
+	// 残り時間の点滅や夜の警告の明滅中は毎フレーム描き直す必要がある
+	bool isTimeUIAnimating() const;
+
 	// 変身エフェクト
 	void triggerTransformEffect(const Vec2& position);
 	void updateTransformEffects();
@@ -116,4 +143,5 @@ private:
 	void updateEnemyAggression();
 	void updateShaderParams();
 	double calculateMoonlight() const;
+	static StringView GetPhaseText(TimePhase phase);
 };
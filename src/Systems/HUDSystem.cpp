@@ -1,4 +1,5 @@
 ﻿#include "HUDSystem.hpp"
+#include "../Core/SimulationClock.hpp"
 
 HUDSystem::HUDSystem()
 	: m_maxLife(6)                      // 3ハート × 2 = 6ライフ
@@ -22,36 +23,43 @@ void HUDSystem::init()
 	loadTextures();
 
 	// フォントの初期化
-	m_numberFont = Font(24, Typeface::Bold);
+	m_numberFont = FontRegistry::Get(24, Typeface::Bold);
+	m_fireballText = GlyphText{ FontRegistry::Get(16) };
+
+	// テクスチャが変わったのでレイヤーと数字を作り直す
+	m_digitAtlas = RenderTexture{};
+	m_dirtyRegions = ALL_REGIONS;
 }
 
 void HUDSystem::loadTextures()
 {
+	m_textureLease.releaseAll();
+
 	// ハートテクスチャの読み込み
-	m_heartTextures.full = Texture(U"Sprites/Tiles/hud_heart.png");
-	m_heartTextures.half = Texture(U"Sprites/Tiles/hud_heart_half.png");
-	m_heartTextures.empty = Texture(U"Sprites/Tiles/hud_heart_empty.png");
+	m_heartTextures.full = m_textureLease.acquire(U"Sprites/Tiles/hud_heart.png");
+	m_heartTextures.half = m_textureLease.acquire(U"Sprites/Tiles/hud_heart_half.png");
+	m_heartTextures.empty = m_textureLease.acquire(U"Sprites/Tiles/hud_heart_empty.png");
 
 	// プレイヤーアイコンテクスチャの読み込み
-	m_playerIconTextures.beige = Texture(U"Sprites/Tiles/hud_player_beige.png");
-	m_playerIconTextures.green = Texture(U"Sprites/Tiles/hud_player_green.png");
-	m_playerIconTextures.pink = Texture(U"Sprites/Tiles/hud_player_pink.png");
-	m_playerIconTextures.purple = Texture(U"Sprites/Tiles/hud_player_purple.png");
-	m_playerIconTextures.yellow = Texture(U"Sprites/Tiles/hud_player_yellow.png");
+	m_playerIconTextures.beige = m_textureLease.acquire(U"Sprites/Tiles/hud_player_beige.png");
+	m_playerIconTextures.green = m_textureLease.acquire(U"Sprites/Tiles/hud_player_green.png");
+	m_playerIconTextures.pink = m_textureLease.acquire(U"Sprites/Tiles/hud_player_pink.png");
+	m_playerIconTextures.purple = m_textureLease.acquire(U"Sprites/Tiles/hud_player_purple.png");
+	m_playerIconTextures.yellow = m_textureLease.acquire(U"Sprites/Tiles/hud_player_yellow.png");
 
 	// コインテクスチャの読み込み
-	m_coinTextures.coin = Texture(U"Sprites/Tiles/hud_coin.png");
+	m_coinTextures.coin = m_textureLease.acquire(U"Sprites/Tiles/hud_coin.png");
 
 	// スターテクスチャの読み込み（新機能）
-	m_starTextures.starOutline = Texture(U"UI/PNG/Yellow/star_outline_depth.png");
-	m_starTextures.starFilled = Texture(U"UI/PNG/Yellow/star.png");
+	m_starTextures.starOutline = m_textureLease.acquire(U"UI/PNG/Yellow/star_outline_depth.png");
+	m_starTextures.starFilled = m_textureLease.acquire(U"UI/PNG/Yellow/star.png");
 
 	// 数字テクスチャの読み込み (0-9)
 	m_coinTextures.numbers.resize(10);
 	for (int i = 0; i < 10; i++)
 	{
 		const String numberPath = U"Sprites/Tiles/hud_character_{}.png"_fmt(i);
-		m_coinTextures.numbers[i] = Texture(numberPath);
+		m_coinTextures.numbers[i] = m_textureLease.acquire(numberPath);
 
 		if (!m_coinTextures.numbers[i])
 		{
@@ -86,12 +94,15 @@ void HUDSystem::update()
 	// ハート揺れアニメーションの更新
 	if (m_heartShakeIntensity > 0.0)
 	{
-		m_heartShakeTimer += Scene::DeltaTime();
+		m_heartShakeTimer += SimulationClock::DeltaTime();
 		m_heartShakePhase += 0.4; // 揺れの速度
 
 		// 揺れ強度の減衰（1秒で完全に停止）
 		m_heartShakeIntensity = Math::Max(0.0, 1.0 - (m_heartShakeTimer / HEART_SHAKE_DURATION));
 
+		// 揺れている間（と止まった直後）はハートを描き直す
+		markDirty(Region::Hearts);
+
 		if (m_heartShakeIntensity <= 0.0)
 		{
 			m_heartShakeTimer = 0.0;
@@ -104,13 +115,160 @@ void HUDSystem::draw() const
 {
 	if (!m_visible) return;
 
-	drawHearts();
-	drawPlayerIcon();
-	drawCoins();
-	drawStars();
+	redrawDirtyRegions();
+
+	// レイヤーは乗算済みアルファで保持している
+	const ScopedRenderStates2D blend{ BlendState::Premultiplied };
+	m_layer.draw(m_layerRect.pos);
+}
+
+void HUDSystem::setPosition(const Vec2& position)
+{
+	if (m_hudPosition == position) return;
+
+	m_hudPosition = position;
+	m_dirtyRegions = ALL_REGIONS;
+}
+
+RectF HUDSystem::getRegionRect(Region region) const
+{
+	// 各 draw 関数が描く範囲（ハートは揺れとグローの分だけ広げる）
+	const double rowY = HEART_SIZE + ELEMENT_SPACING;
+	const double coinX = PLAYER_ICON_SIZE + ELEMENT_SPACING;
+	const double starX = coinX + COIN_ICON_SIZE + 60 + ELEMENT_SPACING;
+
+	switch (region)
+	{
+	case Region::Hearts:
+	{
+		const int heartsCount = (m_maxLife + 1) / 2;
+		const double margin = HEART_SHAKE_AMOUNT * 1.2 + 2.0;
+		return RectF{ m_hudPosition, heartsCount * (HEART_SIZE + 12), HEART_SIZE }.stretched(margin);
+	}
+	case Region::PlayerIcon:
+		return RectF{ m_hudPosition + Vec2(0, rowY), PLAYER_ICON_SIZE, PLAYER_ICON_SIZE };
+	case Region::Coins:
+		return RectF{ m_hudPosition + Vec2(coinX, rowY), COIN_ICON_SIZE + 12 + MAX_COIN_DIGITS * (NUMBER_SIZE - 6) + 6, PLAYER_ICON_SIZE };
+	case Region::Stars:
+		return RectF{ m_hudPosition + Vec2(starX, rowY), Max(m_totalStars, 0) * (STAR_SIZE + 8), PLAYER_ICON_SIZE };
+	case Region::Fireballs:
+		return RectF{ m_hudPosition + Vec2(400, rowY), 160, 40 };
+	default:
+		return RectF{ 0, 0, 0, 0 };
+	}
+}
+
+void HUDSystem::redrawDirtyRegions() const
+{
+	m_lastRedrawnRegionCount = 0;
+
+	// レイヤーは全領域を覆う大きさにし、足りなくなったら作り直す
+	RectF layerRect = getRegionRect(Region::Hearts);
+	for (uint8 i = 1; i < static_cast<uint8>(Region::Count); ++i)
+	{
+		const RectF rect = getRegionRect(static_cast<Region>(i));
+		const double left = Min(layerRect.x, rect.x);
+		const double top = Min(layerRect.y, rect.y);
+		layerRect = RectF{ left, top, Max(layerRect.rightX(), rect.rightX()) - left, Max(layerRect.bottomY(), rect.bottomY()) - top };
+	}
+	layerRect = RectF{ Math::Floor(layerRect.x), Math::Floor(layerRect.y), Math::Ceil(layerRect.w) + 1, Math::Ceil(layerRect.h) + 1 };
+
+	if (!m_layer || m_layerRect != layerRect)
+	{
+		m_layer = RenderTexture{ layerRect.size.asPoint(), ColorF{ 0.0, 0.0 } };
+		m_layerRect = layerRect;
+		m_dirtyRegions = ALL_REGIONS;
+	}
+
+	if (m_dirtyRegions == 0) return;
+
+	if (!m_digitAtlas)
+	{
+		bakeDigitAtlas();
+	}
+
+	// 消す範囲に重なる領域も一緒に描き直す（コイン数の桁が多いと星の領域に重なる）
+	for (bool changed = true; changed;)
+	{
+		changed = false;
+		for (uint8 i = 0; i < static_cast<uint8>(Region::Count); ++i)
+		{
+			if (m_dirtyRegions & (1u << i)) continue;
+
+			const RectF rect = getRegionRect(static_cast<Region>(i));
+			for (uint8 k = 0; k < static_cast<uint8>(Region::Count); ++k)
+			{
+				if ((m_dirtyRegions & (1u << k)) && rect.intersects(getRegionRect(static_cast<Region>(k))))
+				{
+					m_dirtyRegions |= (1u << i);
+					changed = true;
+					break;
+				}
+			}
+		}
+	}
+
+	const ScopedRenderTarget2D target{ m_layer };
+	const Transformer2D transform{ Mat3x2::Translate(-m_layerRect.pos) };
+
+	// 描き直す領域を透明に戻す
+	{
+		const ScopedRenderStates2D opaque{ BlendState::Opaque };
+		for (uint8 i = 0; i < static_cast<uint8>(Region::Count); ++i)
+		{
+			if (m_dirtyRegions & (1u << i))
+			{
+				getRegionRect(static_cast<Region>(i)).draw(ColorF{ 0.0, 0.0 });
+			}
+		}
+	}
+
+	// 透明なレンダーテクスチャへ乗算済みアルファで重ねる（半透明どうしの重なりも直接描いた場合と同じ不透明度になる）
+	BlendState blendState = BlendState::Default2D;
+	blendState.srcAlpha = Blend::One;
+	blendState.dstAlpha = Blend::InvSrcAlpha;
+	blendState.opAlpha = BlendOp::Add;
+	const ScopedRenderStates2D blend{ blendState };
+
+	for (uint8 i = 0; i < static_cast<uint8>(Region::Count); ++i)
+	{
+		if (m_dirtyRegions & (1u << i))
+		{
+			drawRegion(static_cast<Region>(i));
+			++m_lastRedrawnRegionCount;
+		}
+	}
+
+	m_dirtyRegions = 0;
+}
 
-	// ★ ファイアボール残数表示
-	drawFireballs();
+void HUDSystem::drawRegion(Region region) const
+{
+	switch (region)
+	{
+	case Region::Hearts:     drawHearts(); break;
+	case Region::PlayerIcon: drawPlayerIcon(); break;
+	case Region::Coins:      drawCoins(); break;
+	case Region::Stars:      drawStars(); break;
+	case Region::Fireballs:  drawFireballs(); break; // ★ ファイアボール残数表示
+	default:                 break;
+	}
+}
+
+void HUDSystem::bakeDigitAtlas() const
+{
+	m_digitAtlas = RenderTexture{ Size(NUMBER_SIZE * 10, NUMBER_SIZE), ColorF{ 0.0, 0.0 } };
+
+	// 縮小済みの数字をそのまま（アルファも含めて）書き込み、以降は切り出して等倍で描く
+	const ScopedRenderTarget2D target{ m_digitAtlas };
+	const ScopedRenderStates2D opaque{ BlendState::Opaque };
+	for (int i = 0; i < 10 && i < static_cast<int>(m_coinTextures.numbers.size()); ++i)
+	{
+		if (m_coinTextures.numbers[i])
+		{
+			m_coinTextures.numbers[i].resized(NUMBER_SIZE, NUMBER_SIZE).draw(i * NUMBER_SIZE, 0);
+		}
+	}
 }
 
 void HUDSystem::drawFireballs() const
@@ -122,8 +280,8 @@ void HUDSystem::drawFireballs() const
 	Circle(fireballPos + Vec2(20, 20), 10).draw(ColorF(1.0, 0.8, 0.2));
 
 	// 残数表示
-	const String fireballText = U"FB: {}"_fmt(m_remainingFireballs);
-	Font(16)(fireballText).draw(fireballPos + Vec2(50, 10), ColorF(1.0, 1.0, 1.0));
+	m_fireballText.clear().append(U"FB: ").append(m_remainingFireballs);
+	m_fireballText.draw(fireballPos + Vec2(50, 10), ColorF(1.0, 1.0, 1.0));
 }
 
 void HUDSystem::drawHearts() const
@@ -259,30 +417,30 @@ void HUDSystem::drawCoins() const
 
 void HUDSystem::drawNumber(int number, const Vec2& position) const
 {
-	// 数値を文字列に変換
-	const String numberStr = ToString(number);
-
-	// 最低でも1桁は表示（0の場合）
-	const String displayStr = numberStr.isEmpty() ? U"0" : numberStr;
+	// 下の桁から取り出す（文字列を作らない。最低でも1桁は表示）
+	std::array<int, 10> digits;
+	size_t digitCount = 0;
+	uint32 value = static_cast<uint32>(Max(number, 0));
+	do
+	{
+		digits[digitCount++] = static_cast<int>(value % 10);
+		value /= 10;
+	} while (value != 0);
 
-	// 各桁を描画（拡大表示）
-	for (size_t i = 0; i < displayStr.length(); i++)
+	// 各桁をアトラスから切り出して描く（同じテクスチャなので1回の描画にまとまる）
+	for (size_t i = 0; i < digitCount; i++)
 	{
-		const char32 digitChar = displayStr[i];
-		const int digit = digitChar - U'0'; // 文字を数値に変換
+		const int digit = digits[digitCount - 1 - i];
+		const Vec2 digitPos = position + Vec2(i * (NUMBER_SIZE - 6), 0); // 数字間の間隔を調整（拡大版）
 
-		if (digit >= 0 && digit <= 9 && digit < static_cast<int>(m_coinTextures.numbers.size()) && m_coinTextures.numbers[digit])
+		if (m_digitAtlas && digit < static_cast<int>(m_coinTextures.numbers.size()) && m_coinTextures.numbers[digit])
 		{
-			const Vec2 digitPos = position + Vec2(i * (NUMBER_SIZE - 6), 0); // 数字間の間隔を調整（拡大版）
-
-			// 滑らかな拡大表示
-			m_coinTextures.numbers[digit].resized(NUMBER_SIZE, NUMBER_SIZE).draw(digitPos);
+			m_digitAtlas(digit * NUMBER_SIZE, 0, NUMBER_SIZE, NUMBER_SIZE).draw(digitPos);
 		}
 		else
 		{
 			// フォールバック：フォントで描画
-			const Vec2 digitPos = position + Vec2(i * (NUMBER_SIZE - 6), 0);
-			m_numberFont(String(1, digitChar)).draw(digitPos, ColorF(1.0, 1.0, 1.0));
+			m_numberFont(String(1, static_cast<char32>(U'0' + digit))).draw(digitPos, ColorF(1.0, 1.0, 1.0));
 		}
 	}
 }
@@ -315,15 +473,19 @@ void HUDSystem::drawStars() const
 			const Vec2 center = starPos + Vec2(STAR_SIZE / 2, STAR_SIZE / 2);
 			const double radius = STAR_SIZE / 3.0;
 
-			Array<Vec2> starPoints;
+			std::array<Vec2, 10> starPoints;
 			for (int j = 0; j < 10; ++j)
 			{
 				const double angle = j * Math::TwoPi / 10.0 - Math::HalfPi;
 				const double r = (j % 2 == 0) ? radius : radius * 0.5;
-				starPoints.push_back(center + Vec2(std::cos(angle), std::sin(angle)) * r);
+				starPoints[j] = center + Vec2(std::cos(angle), std::sin(angle)) * r;
 			}
 
-			Polygon(starPoints).draw(starColor);
+			// Polygon は頂点と三角形分割を確保するので、中心からの扇形を三角形で描く
+			for (size_t j = 0; j < starPoints.size(); ++j)
+			{
+				Triangle(center, starPoints[j], starPoints[(j + 1) % starPoints.size()]).draw(starColor);
+			}
 		}
 	}
 }
@@ -376,7 +538,7 @@ String HUDSystem::getCharacterColorName(PlayerColor color) const
 void HUDSystem::setCurrentLife(int newLife)
 {
 	const int oldLife = m_currentLife;
-	m_currentLife = Math::Clamp((float)newLife, 0, m_maxLife);
+	updateValue(m_currentLife, static_cast<int>(Math::Clamp((float)newLife, 0, m_maxLife)), Region::Hearts);
 
 	// ライフが減った場合は即座にアニメーション開始
 	if (m_currentLife < oldLife)
@@ -392,7 +554,7 @@ void HUDSystem::setCurrentLife(int newLife)
 
 void HUDSystem::addLife(int amount)
 {
-	m_currentLife = Math::Min((float)m_currentLife + amount, m_maxLife);
+	updateValue(m_currentLife, static_cast<int>(Math::Min((float)m_currentLife + amount, m_maxLife)), Region::Hearts);
 }
 
 void HUDSystem::subtractLife(int amount)
@@ -402,19 +564,19 @@ void HUDSystem::subtractLife(int amount)
 
 void HUDSystem::setPlayerCharacter(PlayerColor color)
 {
-	m_currentPlayerColor = color;
+	updateValue(m_currentPlayerColor, color, Region::PlayerIcon);
 }
 
 void HUDSystem::setPlayerCharacter(int characterIndex)
 {
 	switch (characterIndex)
 	{
-	case 0: m_currentPlayerColor = PlayerColor::Beige; break;
-	case 1: m_currentPlayerColor = PlayerColor::Green; break;
-	case 2: m_currentPlayerColor = PlayerColor::Pink; break;
-	case 3: m_currentPlayerColor = PlayerColor::Purple; break;
-	case 4: m_currentPlayerColor = PlayerColor::Yellow; break;
-	default: m_currentPlayerColor = PlayerColor::Green; break;
+	case 0: setPlayerCharacter(PlayerColor::Beige); break;
+	case 1: setPlayerCharacter(PlayerColor::Green); break;
+	case 2: setPlayerCharacter(PlayerColor::Pink); break;
+	case 3: setPlayerCharacter(PlayerColor::Purple); break;
+	case 4: setPlayerCharacter(PlayerColor::Yellow); break;
+	default: setPlayerCharacter(PlayerColor::Green); break;
 	}
 }
 
@@ -425,4 +587,5 @@ void HUDSystem::notifyDamage()
 	m_heartShakeTimer = 0.0;
 	m_heartShakeIntensity = 1.0;
 	m_heartShakePhase = 0.0;
+	markDirty(Region::Hearts);
 }
@@ -1,7 +1,10 @@
 ﻿#pragma once
 #include <Siv3D.hpp>
 #include "../Player/PlayerColor.hpp"
+#include "../Core/TextureCache.hpp"
+#include "../Core/FontRegistry.hpp"
 
+// 値が変わった領域だけを HUD のレイヤー（RenderTexture）へ描き直し、毎フレームはレイヤーを1枚描くだけにする
 class HUDSystem
 {
 public:
@@ -22,7 +25,7 @@ public:
 
 
 	// ライフ管理
-	void setMaxLife(int maxLife) { m_maxLife = maxLife; }
+	void setMaxLife(int maxLife) { updateValue(m_maxLife, maxLife, Region::Hearts); }
 	void setCurrentLife(int currentLife);
 	void addLife(int amount);
 	void subtractLife(int amount);
@@ -34,19 +37,19 @@ public:
 	void setPlayerCharacter(int characterIndex);
 
 	// コイン管理
-	void setCoins(int coins) { m_coins = coins; }
-	void addCoins(int amount) { m_coins += amount; }
-	void subtractCoins(int amount) { m_coins = Math::Max(0, static_cast<float>(m_coins) - amount); }
+	void setCoins(int coins) { updateValue(m_coins, coins, Region::Coins); }
+	void addCoins(int amount) { setCoins(m_coins + amount); }
+	void subtractCoins(int amount) { setCoins(Math::Max(0, m_coins - amount)); }
 	int getCoins() const { return m_coins; }
 
 	// スター管理（新機能）
-	void setCollectedStars(int collected) { m_collectedStars = collected; }
-	void setTotalStars(int total) { m_totalStars = total; }
+	void setCollectedStars(int collected) { updateValue(m_collectedStars, collected, Region::Stars); }
+	void setTotalStars(int total) { updateValue(m_totalStars, total, Region::Stars); }
 	int getCollectedStars() const { return m_collectedStars; }
 	int getTotalStars() const { return m_totalStars; }
 
 	// HUD表示設定
-	void setPosition(const Vec2& position) { m_hudPosition = position; }
+	void setPosition(const Vec2& position);
 	void setVisible(bool visible) { m_visible = visible; }
 	bool isVisible() const { return m_visible; }
 
@@ -54,10 +57,26 @@ public:
 	void notifyDamage();
 
 	//ファイアボール残機管理
-	void setFireballCount(int remaining) { m_remainingFireballs = remaining; }
+	void setFireballCount(int remaining) { updateValue(m_remainingFireballs, remaining, Region::Fireballs); }
 	int getFireballCount() const { return m_remainingFireballs; }
 
+	// 直前の draw() で描き直した領域の数（キャッシュの効果の確認用）
+	size_t getLastRedrawnRegionCount() const { return m_lastRedrawnRegionCount; }
+
 private:
+	// 描き直しの単位になる HUD の領域
+	enum class Region : uint8
+	{
+		Hearts,
+		PlayerIcon,
+		Coins,
+		Stars,
+		Fireballs,
+
+		Count
+	};
+	static constexpr uint8 ALL_REGIONS = static_cast<uint8>((1u << static_cast<uint8>(Region::Count)) - 1);
+
 	// テクスチャハンドル
 	struct HeartTextures
 	{
@@ -88,6 +107,8 @@ private:
 		Texture starFilled;     // star.png
 	} m_starTextures;
 
+	TextureLease m_textureLease;
+
 	// ゲーム状態
 	int m_maxLife;                  // 最大ライフ (通常は6 = 3ハート × 2)
 	int m_currentLife;              // 現在のライフ
@@ -122,8 +143,36 @@ private:
 
 	// フォント
 	Font m_numberFont;
+	mutable GlyphText m_fireballText;
+
+	// HUD のレイヤーと描き直しが必要な領域（Region のビット）
+	mutable RenderTexture m_layer;
+	mutable RectF m_layerRect{ 0, 0, 0, 0 };  // レイヤーが覆う画面上の範囲
+	mutable uint8 m_dirtyRegions = ALL_REGIONS;
+	mutable size_t m_lastRedrawnRegionCount = 0;
+
+	// 0-9 の数字を NUMBER_SIZE に縮小して横に並べたテクスチャ（初回の描画時に作る）
+	mutable RenderTexture m_digitAtlas;
+	static constexpr int MAX_COIN_DIGITS = 4;  // コイン数の領域の幅（これより多い桁は星の領域に重なる）
 
 	// ヘルパー関数
+	void markDirty(Region region) { m_dirtyRegions |= (1u << static_cast<uint8>(region)); }
+
+	// 値が変わったときだけ代入して領域を描き直し対象にする（毎ティック同じ値を設定されても描き直さない）
+	template <class Type>
+	void updateValue(Type& member, const Type& value, Region region)
+	{
+		if (member == value) return;
+
+		member = value;
+		markDirty(region);
+	}
+
+	RectF getRegionRect(Region region) const;
+	void redrawDirtyRegions() const;
+	void drawRegion(Region region) const;
+	void bakeDigitAtlas() const;
+
 	void loadTextures();
 	void drawHearts() const;
 	void drawPlayerIcon() const;
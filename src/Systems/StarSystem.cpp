@@ -1,5 +1,6 @@
 ﻿#include "StarSystem.hpp"
 #include "../Sound/SoundManager.hpp"
+#include "../Core/SimulationClock.hpp"
 
 StarSystem::StarSystem()
 	: m_collectedStarsCount(0)
@@ -14,8 +15,10 @@ void StarSystem::init()
 
 void StarSystem::loadTextures()
 {
+	m_textureLease.releaseAll();
+
 	// 星テクスチャを読み込み
-	m_starTexture = Texture(U"UI/PNG/Yellow/star.png");
+	m_starTexture = m_textureLease.acquire(U"UI/PNG/Yellow/star.png");
 	
 	if (!m_starTexture)
 	{
@@ -93,8 +96,8 @@ void StarSystem::updateStar(Star& star, const Vec2& playerPosition)
 
 	case StarState::Collected:
 		// 収集アニメーション
-		star.attractTimer += Scene::DeltaTime();
-		star.collectionPhase += Scene::DeltaTime();
+		star.attractTimer += SimulationClock::DeltaTime();
+		star.collectionPhase += SimulationClock::DeltaTime();
 
 		// アニメーション完了後に確実に非アクティブ化
 		if (star.attractTimer >= SPARKLE_DURATION)
@@ -196,7 +199,7 @@ void StarSystem::updateStarAnimation(Star& star)
 		star.scale = pulseScale;
 	}
 
-	star.animationTimer += Scene::DeltaTime();
+	star.animationTimer += SimulationClock::DeltaTime();
 }
 
 void StarSystem::draw(const Vec2& cameraOffset) const
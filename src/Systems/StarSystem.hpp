@@ -2,6 +2,7 @@
 #include <Siv3D.hpp>
 #include "../Player/Player.hpp"
 #include "../Stages/Stage.hpp"
+#include "../Core/TextureCache.hpp"
 
 class StarSystem
 {
@@ -93,6 +94,7 @@ private:
 	// テクスチャ
 	Texture m_starTexture;
 	Texture m_sparkleTexture;
+	TextureLease m_textureLease;
 
 	// 星管理
 	Array<std::unique_ptr<Star>> m_stars;